@@ -17,6 +17,10 @@
 //
 //#define useDataLoggingOutput true			// output 5 basic trip functions to a data logger or SD card, once every refresh period (0.5 second)
 //#define useJSONoutput true					// skybolt added to enable and call JSON out routine
+//#define useBinaryLogging true				// compact COBS-framed binary records, selected per port by setting DLogSerial or JSONoutput to 2
+//#define useDataLogDelta true				// data logging output leaves out fields that changed less than a set percentage, with a full line every 30 seconds
+//#define useDataLogFieldList true			// data logging fields and sample rate divider are stored in EEPROM, so they can be changed without reflashing
+//#define useLogRecordStamps true			// data logging lines and JSON payloads carry a wrapping sequence number and a millisecond timestamp
 //#define useDebugTerminal true				// debugging terminal interface between PC and MPGuino
 //#define useBluetooth true					// bluetooth interface with Android phone
 
@@ -111,7 +115,10 @@
 //
 #define trackIdleEOCdata true				// Ability to track engine idling and EOC modes
 #define useSavedTrips true					// Ability to save current or tank trips to EEPROM
+#define useTripJournal true					// Autosaves current and tank trips every few minutes into a rotating, CRC-checked journal in spare EEPROM
 #define usePartialRefuel true				// Provide means to enter partial refuel amount into MPGuino
+//#define useFuelLog true						// Logs each tank trip into a small CRC-checked ring in EEPROM upon tank reset, with totals and fuel economy range
+//#define useParameterTransfer true			// Ability to export or import all settings parameters at once as a checksummed frame, via debug terminal or bluetooth
 //#define useFuelCost true					// Show fuel cost
 //#define useDragRaceFunction true			// Performs "drag race" 0-60 MPH, 1/4 mile time, estimated horsepower functionality
 //#define useBigFE true						// Show big fuel economy displays
@@ -119,6 +126,7 @@
 //#define useBigTTE true						// Show big time-to-empty displays
 //#define useBarFuelEconVsTime true			// Show Fuel Economy over Time bar graph
 //#define useBarFuelEconVsSpeed true			// Show Fuel Economy vs Speed, Fuel Used vs Speed bar graphs
+//#define useBarEngineLoad true				// Show time at engine speed vs fuel injector duty cycle bar graphs, and export them via data logging output
 //#define useStatusMeter true					// displays a graphical meter for use with MPG display
 //#define useSpiffyTripLabels true			// Ability to use enhanced trip labels on main display screens
 #define useSpiffyBigChars true				// Provides better number font with use with big number displays above
@@ -134,17 +142,24 @@
 
 //#define useDeepSleep true					// (inw) places MPGuino into deep sleep after activity timeout
 //#define useCalculatedFuelFactor true		// (inw) Ability to calculate that pesky us/gal (or L) factor from easily available published fuel injector data
+//#define useRollingTripWindows true			// Provides rolling 10 second, 1 minute, 5 minute, and 30 minute trips (ATmega2560 only, uses 3 kB of RAM)
 
 // performance enhancement options
 //   - all may be chosen independently of one another
 //   - if the performance enhancement option depends on a base option that is not selected, the performance enhancement is ignored
 //
 #define useLCDbufferedOutput true			// Speed up LCD output
+#define useLCDframeBuffer true				// Keeps a shadow copy of the LCD screen, and only sends characters that changed to a 4-bit LCD
+#define useCGRAMglyphCache true			// Shares CGRAM character slots between screens by glyph content, evicting least recently used glyphs
 #define useBluetoothBufferedOutput true		// speed up Bluetooth output on serial port
 #define useLoggingBufferedOutput true		// speed up logging output on serial port
 #define useJSONbufferedOutput true			// speed up JSON output on serial port
 #define useDebugTerminalBufferedOutput true	// speed up debug terminal output on serial port
 #define useWindowTripFilter true			// Smooths out "jumpy" instant FE figures that are caused by modern OBDII engine computers
+//#define useEWMAtripFilter true				// Smooths out instant FE figures with an exponentially weighted trip, using much less RAM than useWindowTripFilter
+#define useSeqlockTripAccess true			// Main program reads live trip data via sequence count instead of disabling interrupts
+#define useEEPROMparameterCache true		// Keeps a RAM copy of settings parameters, and writes changed parameters back to EEPROM in the background
+#define useEEPROMwriteQueue true			// Programs EEPROM bytes from the EEPROM ready interrupt, instead of stalling with interrupts disabled
 #define useAssemblyLanguage true			// Speeds up many low-level MPGuino functions
 
 // serial speed options
@@ -344,6 +359,11 @@
 #define useBarGraph true
 #endif // defined(useBarFuelEconVsSpeed)
 
+#if defined(useBarEngineLoad)
+#define useExpandedMainDisplay true
+#define useBarGraph true
+#endif // defined(useBarEngineLoad)
+
 #if defined(useBigTTE)
 #define useExpandedMainDisplay true
 #define useBigTimeDisplay true
@@ -358,6 +378,10 @@
 #define useExpandedMainDisplay true
 #endif // defined(useCPUreading)
 
+#if defined(useFuelLog)
+#define useExpandedMainDisplay true
+#endif // defined(useFuelLog)
+
 #if defined(useClockDisplay)
 #define useExpandedMainDisplay true
 #endif // defined(useClockDisplay)
@@ -372,6 +396,8 @@
 
 #if defined(useSpiffyTripLabels) || defined(useBigDigitDisplay) || defined(useBarGraph) || defined(useLCDfonts)
 #define useLCDgraphics true
+#else // defined(useSpiffyTripLabels) || defined(useBigDigitDisplay) || defined(useBarGraph) || defined(useLCDfonts)
+#undef useCGRAMglyphCache
 #endif // defined(useSpiffyTripLabels) || defined(useBigDigitDisplay) || defined(useBarGraph) || defined(useLCDfonts)
 
 #if defined(useDebugTerminal)
@@ -445,6 +471,9 @@
 #error *** Logging Output requires exactly one I/O port!!! ***
 #endif // ( defined(useLoggingSerialPort0) + defined(useLoggingSerialPort1) + defined(useLoggingSerialPort2) + defined(useLoggingSerialPort3) + defined(useLoggingSerialUSB) ) != 1
 #else // defined(useDataLoggingOutput)
+#undef useBinaryLogging
+#undef useDataLogDelta
+#undef useDataLogFieldList
 #undef useLoggingSerialPort0
 #undef useLoggingSerialPort1
 #undef useLoggingSerialPort2
@@ -468,6 +497,10 @@
 #undef useJSONbufferedOutput
 #endif // defined(useJSONoutput)
 
+#if !defined(useDataLoggingOutput) && !defined(useJSONoutput)
+#undef useLogRecordStamps
+#endif // !defined(useDataLoggingOutput) && !defined(useJSONoutput)
+
 #if defined(useDebugTerminal)
 #if ( defined(useDebugTerminalSerialPort0) + defined(useDebugTerminalSerialPort1) + defined(useDebugTerminalSerialPort2) + defined(useDebugTerminalSerialPort3) + defined(useDebugTerminalSerialUSB) ) != 1
 #error *** Debug Terminal output requires exactly one I/O port!!! ***
@@ -948,6 +981,8 @@
 
 #if defined(usePort4BitLCD) || defined(useTWI4BitLCD)
 #define use4BitLCD true
+#else // defined(usePort4BitLCD) || defined(useTWI4BitLCD)
+#undef useLCDframeBuffer
 #endif // defined(usePort4BitLCD) || defined(useTWI4BitLCD)
 
 #if defined(usePort4BitLCD) || defined (useSerialLCD) || defined(useTWI4BitLCD)
@@ -1069,6 +1104,22 @@
 #error *** CANNOT use both useCarVoltageOutput and useChryslerBaroSensor!!! ***
 #endif // defined(useCarVoltageOutput) && defined(useChryslerBaroSensor)
 
+#if defined(useWindowTripFilter) && defined(useEWMAtripFilter)
+#error *** CANNOT use both useWindowTripFilter and useEWMAtripFilter!!! ***
+#endif // defined(useWindowTripFilter) && defined(useEWMAtripFilter)
+
+#if defined(useTripJournal) && !defined(useSavedTrips)
+#error *** useTripJournal requires useSavedTrips!!! ***
+#endif // defined(useTripJournal) && !defined(useSavedTrips)
+
+#if defined(useParameterTransfer) && !defined(useDebugTerminal) && !defined(useBluetooth)
+#error *** useParameterTransfer requires useDebugTerminal or useBluetooth!!! ***
+#endif // defined(useParameterTransfer) && !defined(useDebugTerminal) && !defined(useBluetooth)
+
+#if defined(useRollingTripWindows) && !defined(__AVR_ATmega2560__)
+#error *** useRollingTripWindows requires ATmega2560 hardware, due to RAM usage!!! ***
+#endif // defined(useRollingTripWindows) && !defined(__AVR_ATmega2560__)
+
 #if defined(useHardwareSPI)
 #if defined(__AVR_ATmega328P__) && ( defined(useOutputPins) || defined(useActivityLED) )
 #error *** Conflict exists between useHardwareSPI and useOutputPins / useActivityLED!!! ***
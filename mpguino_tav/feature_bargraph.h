@@ -61,38 +61,54 @@ namespace bgFEvsSsupport /* fuel economy over speed histograph support section p
 {
 
 	static void reset(void);
+	static void selectBucket(uint32_t speed);
+	static void update(uint8_t tripIdx);
+	static void load64(union union_64 * an, uint8_t barIdx, uint8_t dataIdx);
 
 };
 
+// the fuel econ vs speed histogram only keeps what fuel economy, fuel used, and distance need - VSS pulses and injector open cycles
+//
+// each bucket costs 10 bytes (32-bit VSS pulse count, 48-bit injector cycle count), instead of the 12 bytes of a trip slot
+//
+// bucket edges are either linear (each bucket is pBarSpeedQuantumIdx wide) or logarithmic (each bucket is wider than the one
+//    before it by the ratio of (pBarLowSpeedCutoffIdx + pBarSpeedQuantumIdx) / pBarLowSpeedCutoffIdx)
+//
+// bucket edges are worked out once whenever the histogram is reset, so that finding the current bucket for each speed sample
+//    is only a 32-bit compare loop
+//
+// if there are more buckets than can be displayed at once, the bargraph display scrolls to follow the current bucket
+//
+static const uint8_t bgFEvSbucketCount = 18;		// may be changed - 18 buckets take up the same RAM as the old 15 trip slots
+static const uint8_t bgFEvSfuelSize = 6;			// injector cycle counts are stored as 48-bit values
+
+uint32_t FEvSdistance[(uint16_t)(bgFEvSbucketCount)];
+uint32_t FEvSbucketEdge[(uint16_t)(bgFEvSbucketCount - 1)]; // upper edge of each bucket - the last bucket has no upper edge
+uint8_t FEvSfuel[(uint16_t)(bgFEvSbucketCount)][(uint16_t)(bgFEvSfuelSize)];
+uint8_t FEvSbucketIdx;
+uint8_t FEvSwindowStart;
+uint8_t FEvSlogScale;
 uint8_t FEvSpdTripIdx;
 
 static const uint8_t prgmFEvsSpeed[] PROGMEM = {
 	instrLdRegTripVarIndexed, 0x02, rvVSScycleIdx,		// load VSS cycle value into register 2
 	instrTestReg, 0x02,									// test VSS cycle value
-	instrBranchIfZero, 15,								// if zero, then speed is also zero
+	instrBranchIfZero, 10,								// if zero, then speed is also zero
 	instrLdReg, 0x21,									// save denominator term for later
 	instrLdRegTripVarIndexed, 0x02, rvVSSpulseIdx,		// load VSS pulse count
 	instrMul2byConst, idxDecimalPoint,					// adjust by decimal formatting term
 	instrMul2byConst, idxCycles0PerSecond,				// set up to convert VSS cycle value to time in seconds
-	instrDiv2by1,										// divide to obtain vehicle speed
+	instrDiv2by1,										// divide to obtain vehicle speed in (VSS pulses)(* 1000) / (second)
 
 //cont:
-	instrSubMainFromX, 0x02, mpFEvsSpeedMinThresholdIdx,	// compare vehicle speed to minimum threshold
-	instrBranchIfLTorE, 4,								// if vehicle speed is above minimum threshold, skip ahead
-
-//badRet:
-	instrLdRegByte, 0x02, 0xFF,							// load a 255 into register 2
-	instrDone,											// exit to caller
-
-//cont2:
-	instrDiv2byMain, mpFEvsSpeedQuantumIdx,				// find trip index offset
-	instrLdRegByte, 0x01, bgDataSize - 1,				// is offset greater than the number of available trip slots
-	instrCmpXtoY, 0x21,
-	instrBranchIfLTorE, 2,								// if not, skip ahead
-	instrLdReg, 0x12,									// load the last trip slot index
-
-//cont3:
-	instrAddByteToX, 0x02, FEvsSpeedIdx,				// obtain working fuel econ vs speed trip index value
+	instrDone											// exit to caller
+};
+
+static const uint8_t prgmFEvsSpeedNextEdge[] PROGMEM = {
+	instrLdReg, 0x23,									// save lower edge of bucket
+	instrMul2byMain, mpFEvsSpeedQuantumIdx,				// multiply lower edge by speed quantum
+	instrDiv2byMain, mpFEvsSpeedMinThresholdIdx,		// divide by minimum threshold speed to get logarithmic bucket width
+	instrAddYtoX, 0x32,									// add bucket width to lower edge to get upper edge
 	instrDone											// exit to caller
 };
 
@@ -115,4 +131,51 @@ static const uint8_t barFEvSgraphFuncs[] PROGMEM = {
 };
 
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useBarEngineLoad)
+namespace bgEngineLoad /* engine speed vs fuel injector duty cycle histograph support section prototype */
+{
+
+	static void reset(void);
+	static void update(uint8_t tripIdx);
+	static uint32_t getBandTime(uint8_t speedBand, uint8_t cursorPos);
+	static void fillBarGraph(uint8_t cursorPos);
+#if defined(useDataLoggingOutput)
+	static void outputDataLog(void);
+#endif // defined(useDataLoggingOutput)
+
+};
+
+// time spent in each engine speed band and fuel injector duty cycle band, in samples (1 / loopsPerSecond seconds each)
+//
+// each sample is classified once from the per-sample injector totals, not from individual injector pulses
+//
+// samples without any injector pulses (fuel cut) count in the lowest duty cycle band, at the last known engine speed band
+//
+// counters saturate instead of wrapping around - at 2 samples per second, a band fills up after a little more than 9 hours
+//
+static const uint8_t elSpeedBandCount = bgDataSize;			// one engine speed band per bar
+static const uint32_t elSpeedBandWidth = 500000ul;			// 500 RPM per engine speed band, in (RPM)(* 1000) - last band catches all higher speeds
+static const uint8_t elDutyBandCount = 5;					// 20% fuel injector duty cycle per band
+
+uint16_t elHistogram[(uint16_t)(elSpeedBandCount)][(uint16_t)(elDutyBandCount)];
+uint8_t elSpeedBand;
+
+static const uint8_t prgmEngineDutyBand[] PROGMEM = {
+	instrLdRegTripVarIndexed, 0x02, rvInjCycleIdx,		// load injector open cycle value into register 2
+	instrMul2byByte, elDutyBandCount,					// multiply by the number of fuel injector duty cycle bands
+	instrLdRegTripVarIndexed, 0x01, rvEngCycleIdx,		// load engine run time cycle value into register 1
+	instrDiv2by1,										// divide to obtain fuel injector duty cycle band
+	instrDone											// exit to caller
+};
+
+static const char barEngineLoadFuncNames[] PROGMEM = {
+	"Time @ RPM" tcEOS
+	"RPM@Duty 0-20%" tcEOS
+	"RPM@Duty 20-40%" tcEOS
+	"RPM@Duty 40-60%" tcEOS
+	"RPM@Duty 60-80%" tcEOS
+	"RPM@Duty80-100%" tcEOS
+};
+
+#endif // defined(useBarEngineLoad)
 #endif // defined(useBarGraph)
@@ -5,19 +5,281 @@
 static void bgFEvsSsupport::reset(void)
 {
 
-	for (uint8_t x = 0; x < bgDataSize; x++) tripVar::reset(FEvsSpeedIdx + x);
+	uint32_t edge;
+	uint32_t lowSpeed;
+	uint32_t quantum;
 
+	for (uint8_t x = 0; x < bgFEvSbucketCount; x++)
+	{
+
+		FEvSdistance[(uint16_t)(x)] = 0;
+		for (uint8_t y = 0; y < bgFEvSfuelSize; y++) FEvSfuel[(uint16_t)(x)][(uint16_t)(y)] = 0;
+
+	}
+
+	FEvSlogScale = EEPROM::readByte(pBarSpeedScaleIdx);
+
+	lowSpeed = mainProgramVariables[(uint16_t)(mpFEvsSpeedMinThresholdIdx)];
+	quantum = mainProgramVariables[(uint16_t)(mpFEvsSpeedQuantumIdx)];
+
+	edge = lowSpeed;
+
+	for (uint8_t x = 0; x < bgFEvSbucketCount - 1; x++)
+	{
+
+		if (FEvSlogScale && lowSpeed) // logarithmic bucket width is proportional to its lower edge
+		{
+
+			SWEET64::init64((union union_64 *)(&s64reg[s64reg2]), edge);
+			edge = SWEET64::runPrgm(prgmFEvsSpeedNextEdge, 0);
+			if (((union union_64 *)(&s64reg[s64reg2]))->ul[1]) edge = 0xFFFFFFFF; // upper edge is beyond any measurable speed
+
+		}
+		else if (edge > 0xFFFFFFFF - quantum) edge = 0xFFFFFFFF; // linear bucket width is constant
+		else edge += quantum;
+
+		FEvSbucketEdge[(uint16_t)(x)] = edge;
+
+	}
+
+	FEvSbucketIdx = 255;
+	FEvSwindowStart = 0;
 	FEvSpdTripIdx = 255;
 
 }
 
+static void bgFEvsSsupport::selectBucket(uint32_t speed)
+{
+
+	uint8_t i;
+
+	if ((speed == 0) || (speed < mainProgramVariables[(uint16_t)(mpFEvsSpeedMinThresholdIdx)])) i = 255; // vehicle is stopped, or is going too slow to be measured
+	else
+	{
+
+		// find the bucket whose upper edge lies above the vehicle speed - the last bucket catches all higher speeds
+		for (i = 0; i < bgFEvSbucketCount - 1; i++) if (speed < FEvSbucketEdge[(uint16_t)(i)]) break;
+
+	}
+
+	FEvSbucketIdx = i;
+
+	if (i < bgFEvSbucketCount)
+	{
+
+		// scroll the displayed bars just enough to keep the current bucket visible
+		if (i < FEvSwindowStart) FEvSwindowStart = i;
+		else if (i >= FEvSwindowStart + bgDataSize) FEvSwindowStart = i - bgDataSize + 1;
+
+		FEvSpdTripIdx = FEvsSpeedIdx + i - FEvSwindowStart;
+
+	}
+	else FEvSpdTripIdx = 255;
+
+}
+
+static void bgFEvsSsupport::update(uint8_t tripIdx)
+{
+
+	union union_64 fuel;
+	uint8_t i;
+
+	i = FEvSbucketIdx;
+
+	if (i < bgFEvSbucketCount)
+	{
+
+		fuel.ull = 0;
+		for (uint8_t x = 0; x < bgFEvSfuelSize; x++) fuel.u8[(uint16_t)(x)] = FEvSfuel[(uint16_t)(i)][(uint16_t)(x)];
+
+		fuel.ull += collectedInjCycleCount[(uint16_t)(tripIdx)];
+		FEvSdistance[(uint16_t)(i)] += collectedVSSpulseCount[(uint16_t)(tripIdx)];
+
+		for (uint8_t x = 0; x < bgFEvSfuelSize; x++) FEvSfuel[(uint16_t)(i)][(uint16_t)(x)] = fuel.u8[(uint16_t)(x)];
+
+	}
+
+}
+
+static void bgFEvsSsupport::load64(union union_64 * an, uint8_t barIdx, uint8_t dataIdx)
+{
+
+	uint8_t i;
+
+	i = FEvSwindowStart + barIdx;
+
+	SWEET64::init64byt(an, 0);
+
+	if (i < bgFEvSbucketCount)
+	{
+
+		switch (dataIdx)
+		{
+
+			case rvVSSpulseIdx:
+				an->ul[0] = FEvSdistance[(uint16_t)(i)];
+				break;
+
+			case rvInjCycleIdx:
+				for (uint8_t x = 0; x < bgFEvSfuelSize; x++) an->u8[(uint16_t)(x)] = FEvSfuel[(uint16_t)(i)][(uint16_t)(x)];
+				break;
+
+			default:
+				break;
+
+		}
+
+	}
+
+}
+
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useBarEngineLoad)
+/* engine speed vs fuel injector duty cycle histograph support section */
+
+static void bgEngineLoad::reset(void)
+{
+
+	for (uint8_t x = 0; x < elSpeedBandCount; x++)
+		for (uint8_t y = 0; y < elDutyBandCount; y++) elHistogram[(uint16_t)(x)][(uint16_t)(y)] = 0;
+
+	elSpeedBand = 255;
+
+}
+
+static void bgEngineLoad::update(uint8_t tripIdx)
+{
+
+	uint32_t i;
+	uint32_t j;
+
+	if (collectedEngCycleCount[(uint16_t)(tripIdx)] == 0) elSpeedBand = 255; // engine was not running during this sample
+	else
+	{
+
+		if (collectedInjPulseCount[(uint16_t)(tripIdx)]) // if the fuel injectors fired during this sample
+		{
+
+			i = SWEET64::runPrgm(prgmEngineSpeed, tripIdx) / elSpeedBandWidth; // find engine speed band
+			if (i >= elSpeedBandCount) i = elSpeedBandCount - 1;
+
+			j = SWEET64::runPrgm(prgmEngineDutyBand, tripIdx); // find fuel injector duty cycle band
+			if (j >= elDutyBandCount) j = elDutyBandCount - 1;
+
+		}
+		else // otherwise, fuel was cut off (engine speed cannot be found without injector pulses), so count it in the lowest duty cycle band
+		{
+
+			if (elSpeedBand < elSpeedBandCount) i = elSpeedBand; // assume engine is still turning at the last known engine speed
+			else i = 0;
+
+			j = 0;
+
+		}
+
+		if (elHistogram[(uint16_t)(i)][(uint16_t)(j)] < 65535) elHistogram[(uint16_t)(i)][(uint16_t)(j)]++;
+
+		elSpeedBand = i;
+
+	}
+
+}
+
+static uint32_t bgEngineLoad::getBandTime(uint8_t speedBand, uint8_t cursorPos)
+{
+
+	uint32_t t;
+
+	t = 0;
+
+	// cursor position 0 sums up all duty cycle bands, the remaining cursor positions select a single duty cycle band
+	for (uint8_t y = 0; y < elDutyBandCount; y++)
+		if ((cursorPos == 0) || (cursorPos == y + 1)) t += elHistogram[(uint16_t)(speedBand)][(uint16_t)(y)];
+
+	return t;
+
+}
+
+static void bgEngineLoad::fillBarGraph(uint8_t cursorPos)
+{
+
+	uint32_t high;
+	uint32_t t;
+
+	high = 0;
+
+	for (uint8_t x = 0; x < elSpeedBandCount; x++)
+	{
+
+		t = getBandTime(x, cursorPos);
+		if (t > high) high = t;
+
+	}
+
+	// normalize the same way prgmGenerateHistographData does, with the highest bar at 100
+	for (uint8_t x = 0; x < elSpeedBandCount; x++)
+	{
+
+		t = getBandTime(x, cursorPos);
+
+		if (t)
+		{
+
+			t = (t * 100 + high / 2) / high;
+			if (t == 0) t = 1; // ensure any time spent in a band still shows up
+
+		}
+
+		bargraphData[(uint16_t)(x)] = t;
+
+	}
+
+}
+
+#if defined(useDataLoggingOutput)
+// outputs one line per engine speed band - lower band edge in RPM, then time in seconds spent in each duty cycle band
+static void bgEngineLoad::outputDataLog(void)
+{
+
+	uint8_t c;
+
+	text::stringOut(devLogOutput, PSTR("RPM,0-20%,20-40%,40-60%,60-80%,80-100%\n"));
+
+	for (uint8_t x = 0; x < elSpeedBandCount; x++)
+	{
+
+		SWEET64::init64((union union_64 *)(&s64reg[s64reg2]), x * elSpeedBandWidth);
+		text::stringOut(devLogOutput, ull2str(nBuff, 0, 0, (dfOverflow9s)));
+
+		c = ',';
+
+		for (uint8_t y = 0; y < elDutyBandCount; y++)
+		{
+
+			text::charOut(devLogOutput, c);
+
+			SWEET64::init64((union union_64 *)(&s64reg[s64reg2]), (uint32_t)(elHistogram[(uint16_t)(x)][(uint16_t)(y)]) * 1000ul / loopsPerSecond);
+			text::stringOut(devLogOutput, ull2str(nBuff, 1, 0, (dfOverflow9s)));
+
+		}
+
+		text::charOut(devLogOutput, '\n');
+
+	}
+
+}
+
+#endif // defined(useDataLoggingOutput)
+#endif // defined(useBarEngineLoad)
 #if defined(useBarFuelEconVsTime)
 /* fuel economy over time histograph support section */
 
 static uint8_t bgFEvsTsupport::getFEvTperiodIdx(void)
 {
 
+#if defined(useSeqlockTripAccess)
+	return FEvTperiodIdx; // a single byte read cannot be torn by the timer0 interrupt handler
+#else // defined(useSeqlockTripAccess)
 	uint8_t oldSREG;
 	uint8_t retVal;
 
@@ -29,6 +291,7 @@ static uint8_t bgFEvsTsupport::getFEvTperiodIdx(void)
 	SREG = oldSREG; // restore interrupt flag status
 
 	return retVal;
+#endif // defined(useSeqlockTripAccess)
 
 }
 
@@ -124,7 +387,7 @@ static uint8_t barGraphSupport::displayHandler(uint8_t cmd, uint8_t cursorPos)
 		case barFEvSdisplayIdx:
 			labelList = barFEvSfuncNames;
 
-			if (FEvSpdTripIdx < tripSlotCount) i = FEvSpdTripIdx - FEvsSpeedIdx + 1;
+			if (FEvSpdTripIdx != 255) i = FEvSpdTripIdx - FEvsSpeedIdx + 1;
 			else i = 0;
 
 			graphCursorPos = i - 1;
@@ -165,6 +428,23 @@ static uint8_t barGraphSupport::displayHandler(uint8_t cmd, uint8_t cursorPos)
 			break;
 
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useBarEngineLoad)
+		case barEngineLoadDisplayIdx:
+			labelList = barEngineLoadFuncNames;
+
+			bgEngineLoad::fillBarGraph(cursorPos);
+
+			graphCursorPos = elSpeedBand;
+			graphCalcIdx = 255; // bar graph data is already filled in
+			differentialFlag = 0; // no differential graphs for engine load
+
+			line0TripIdx = instantIdx;
+			line0CalcIdx = tEngineSpeed;
+			line1TripIdx = tankIdx;
+			line1CalcIdx = tEngineSpeed;
+			break;
+
+#endif // defined(useBarEngineLoad)
 	}
 
 	switch (cmd)
@@ -239,7 +519,7 @@ static void barGraphSupport::graphData(uint8_t cursorPos, uint8_t calcIdx, uint8
 	uint8_t blinkFlag;
 	uint8_t fl;
 
-	SWEET64::runPrgm(prgmGenerateHistographData, calcIdx);
+	if (calcIdx != 255) SWEET64::runPrgm(prgmGenerateHistographData, calcIdx); // a calcIdx of 255 means bargraphData is already filled in
 
 	rollSum = 0;
 	yStart = 0;
@@ -68,6 +68,12 @@ static const char mainMenuTitles[] PROGMEM = {	// each title must be no longer t
 #if defined(useBarFuelEconVsSpeed)
 	"FE/Speed" tcEOSCR
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useBarEngineLoad)
+	"Engine Load" tcEOSCR
+#endif // defined(useBarEngineLoad)
+#if defined(useFuelLog)
+	"Fuel Log" tcEOSCR
+#endif // defined(useFuelLog)
 #if defined(useBigDTE)
 	"Big DistToE" tcEOSCR
 #endif // defined(useBigDTE)
@@ -226,4 +232,30 @@ static const char deFormatNoChange[] PROGMEM = "Disp Unchanged";
 static const char deFormatSaved[] PROGMEM = "Disp Changed";
 
 #endif // defined(useScreenEditor)
+#if defined(useFuelLog)
+static const uint16_t fuelLogPageFormats[] PROGMEM = {
+	 (fuelLogTotalIdx << 8 ) |			(tFuelEcon)			// log totals
+	,(fuelLogTotalIdx << 8 ) |			(tDistance)
+	,(fuelLogTotalIdx << 8 ) |			(tFuelUsed)
+	,(fuelLogTotalIdx << 8 ) |			(tEngineRunTime)
+
+	,(fuelLogMinFEidx << 8 ) |			(tFuelEcon)			// log fuel economy range
+	,(fuelLogMinFEidx << 8 ) |			(tDistance)
+	,(fuelLogMaxFEidx << 8 ) |			(tFuelEcon)
+	,(fuelLogMaxFEidx << 8 ) |			(tDistance)
+
+	,(fuelLogRecordIdx << 8 ) |			(tFuelEcon)			// individual logged tank
+	,(fuelLogRecordIdx << 8 ) |			(tDistance)
+	,(fuelLogRecordIdx << 8 ) |			(tFuelUsed)
+	,(fuelLogRecordIdx << 8 ) |			(tEngineRunTime)
+};
+
+static const char fuelLogPageTitles[] PROGMEM = {
+	"Fuel Log Totals" tcEOS
+	"Fuel Log FE Rng" tcEOS
+	"Logged Tank" tcEOS
+	"No Logged Tank" tcEOS
+};
+
+#endif // defined(useFuelLog)
 #endif // defined(useButtonInput)
@@ -269,21 +269,22 @@ static void statusBar::writeStatusBarElement(uint8_t chr, uint8_t val)
 
 	uint8_t cgrAddress;
 	uint8_t bmsk;
-	uint8_t i;
+	char chrData[8];
 
 	cgrAddress = ((chr & 0x07) << 3);
 
 	bmsk = pgm_read_byte(&statusBarElement[(uint16_t)(val)]);
 
-	for (uint8_t x = 1; x < 6; x++)
+	for (uint8_t x = 0; x < 8; x++)
 	{
 
-		i = LCD::peekCGRAMbyte(cgrAddress + x);
-		i |= (bmsk);
-		LCD::writeCGRAMbyte(cgrAddress + x, i);
+		chrData[(uint16_t)(x)] = LCD::peekCGRAMbyte(cgrAddress + x);
+		if ((x > 0) && (x < 6)) chrData[(uint16_t)(x)] |= (bmsk);
 
 	}
 
+	LCD::loadCGRAMcharacter(chr, chrData); // redefine the whole character, so a glyph cache can match it by content
+
 }
 
 #endif // defined(useStatusMeter)
@@ -7,6 +7,28 @@ typedef struct
 
 } bluetoothFunction;
 
+typedef uint8_t (* btInputFunc)(uint8_t); // type for bluetooth input state handlers - returns the next input state
+typedef uint8_t (* btCommandFunc)(void); // type for bluetooth expanded command handlers - returns the next input state
+
+typedef struct
+{
+
+	uint8_t btCmdChar;
+	btCommandFunc btCmdFunc;
+
+} bluetoothCommand;
+
+typedef struct
+{
+
+	uint8_t btSubChar;
+	uint8_t btSubInterval;
+	uint8_t btSubCount;
+	uint8_t btSubFlags;
+	uint32_t btSubLastValue;
+
+} bluetoothSubscription;
+
 namespace bluetooth /* Bluetooth interface terminal section prototype */
 {
 
@@ -14,6 +36,34 @@ namespace bluetooth /* Bluetooth interface terminal section prototype */
 	static void shutdown(void);
 	static uint16_t findFormat(uint8_t inpChar);
 	static void mainProcess(void);
+	static uint8_t inputIdle(uint8_t btChar);
+	static uint8_t inputExpandedCommand(uint8_t btChar);
+	static uint8_t inputTripOutput(uint8_t btChar);
+	static uint8_t inputBatchQuery(uint8_t btChar);
+	static uint8_t inputBatchSet(uint8_t btChar);
+	static uint8_t inputSubscribe(uint8_t btChar);
+	static uint8_t inputListCheck(uint8_t btChar, uint8_t btState);
+#if defined(useParameterTransfer)
+	static uint8_t inputParameterFrame(uint8_t btChar);
+#endif // defined(useParameterTransfer)
+	static uint8_t inputNumber(uint8_t btChar);
+	static uint8_t cmdOutputParameters(void);
+	static uint8_t cmdResetCurrent(void);
+	static uint8_t cmdResetTank(void);
+	static uint8_t cmdBatchQuery(void);
+	static uint8_t cmdBatchSet(void);
+	static uint8_t cmdSubscribe(void);
+#if defined(useParameterTransfer)
+	static uint8_t cmdExportParameters(void);
+	static uint8_t cmdImportParameters(void);
+#endif // defined(useParameterTransfer)
+	static void resetOutput(void);
+	static uint16_t valueFormat(uint8_t btChar);
+	static uint8_t outputValue(uint8_t btChar);
+	static void listNext(void);
+	static void pushNext(void);
+	static void outputBatch(void);
+	static void holdOutput(void);
 	static void mainOutput(void);
 #if defined(useBluetoothAdaFruitSPI)
 	static void chrOut(uint8_t chr);
@@ -35,6 +85,20 @@ list of commands sent from MPGuino Blue android app
 MM                - output selected EEPROM parameter values
 MR                - reset current trip and save to EEPROM
 MT                - reset tank trip (and partial, if configured) and save to EEPROM
+MG                - output all settings parameters as one checksummed {frame} (if useParameterTransfer is configured)
+MW{...}           - read in a checksummed {frame}, and store all settings parameters from it (if useParameterTransfer is configured)
+MQxyz...;         - output the values of variables x, y, z, ... as one <batch> response
+MSxdddKdddKydddKdddK...;
+                  - store variables x, y, ... (each digit string is sent twice, as with single variable writes), then
+                    output the stored values as one <batch> response - a variable whose digit strings did not match
+                    is left unchanged, and is left out of the response
+MPxdddKydddK...;  - subscribe to variables x, y, ... with a minimum interval ddd for each, counted in Bluetooth output periods
+                    (ddd of 0 or 1 means every period) - replaces the ! trip function output with push output, where a
+                    subscribed variable is sent once right away, and afterwards only when its value has changed and at
+                    least its minimum interval has passed since it was last sent
+MP;               - cancel all subscriptions, and stop push output
+                  - any output in progress, other than push output of the old subscription list, continues until the ;
+                    of MP arrives
 !                 - initialize and output selected trip functions
 RdddddddddddK     - store pPulsesPerDistanceIdx value to EEPROM
 SdddddddddddK     - store pMicroSecondsPerGallonIdx value to EEPROM
@@ -76,12 +140,92 @@ Xddddddddddd      - pVSSpauseIdx
 Yddddddddddd      - pInjEdgeTriggerIdx
 Zddddddddddd      - pVoltageOffset
 
+output from MQ and MS commands
+------------------------------
+<xdddddddddddyddddddddddd...>
+                  - each requested variable, in the order requested, with no delay between variables
+
+output from MP command
+----------------------
+xddddddddddd      - each subscribed variable, one at a time, as for the ! command
+
+an MQ or MS variable list that is not ended with ; is dropped once an M or ! arrives, which then starts that next
+command, or once more than 64 characters of the list have been read in - ! thus cannot be requested or stored with
+MQ or MS, or subscribed to with MP
+
+an MP subscription list that is not ended with ; ends the same way, but the subscriptions read in so far are kept,
+and push output starts for them
+
+! and MM commands cancel push output - subscriptions must be sent again with MP afterwards
+
+the MG command, if useParameterTransfer is configured, pauses any ! trip function output or push output while the
+{frame} goes out, and then resumes it
+
 */
 
 static uint8_t btInputState;
 
-static const uint8_t btiStringInput =			0b10000000;
-static const uint8_t btiGetSecondaryCharacter =	0b01000000;
+#define nextAllowedValue 0
+static const uint8_t btiIdle =					nextAllowedValue;				// normal command processing
+static const uint8_t btiExpandedCommand =		btiIdle + 1;					// processing an expanded command
+static const uint8_t btiTripOutput =			btiExpandedCommand + 1;			// processing a '!' command
+static const uint8_t btiBatchQuery =			btiTripOutput + 1;				// reading in a MQ variable list
+static const uint8_t btiBatchSet =				btiBatchQuery + 1;				// reading in a MS variable list
+static const uint8_t btiSubscribe =				btiBatchSet + 1;				// reading in a MP subscription list
+#define nextAllowedValue btiSubscribe + 1
+#if defined(useParameterTransfer)
+
+static const uint8_t btiParameterFrame =		nextAllowedValue;				// processing a parameter transfer frame
+#define nextAllowedValue btiParameterFrame + 1
+#endif // defined(useParameterTransfer)
+
+static const uint8_t btiStateCount =			nextAllowedValue;				// input states at or above this are K-delimited number input for that variable character
+
+static const uint8_t btiCheckDigits =			0b10000000;						// K-delimited number input is reading in the second (check) digit string
+
+static const btInputFunc btInputHandlerList[] PROGMEM = { // indexed by input state
+	 bluetooth::inputIdle
+	,bluetooth::inputExpandedCommand
+	,bluetooth::inputTripOutput
+	,bluetooth::inputBatchQuery
+	,bluetooth::inputBatchSet
+	,bluetooth::inputSubscribe
+#if defined(useParameterTransfer)
+	,bluetooth::inputParameterFrame
+#endif // defined(useParameterTransfer)
+};
+
+static const bluetoothCommand btCommandList[] PROGMEM = { // expanded commands, as in M<char>
+	 {'M',	bluetooth::cmdOutputParameters}
+	,{'R',	bluetooth::cmdResetCurrent}
+	,{'T',	bluetooth::cmdResetTank}
+	,{'Q',	bluetooth::cmdBatchQuery}
+	,{'S',	bluetooth::cmdBatchSet}
+	,{'P',	bluetooth::cmdSubscribe}
+#if defined(useParameterTransfer)
+	,{'G',	bluetooth::cmdExportParameters}
+	,{'W',	bluetooth::cmdImportParameters}
+#endif // defined(useParameterTransfer)
+};
+
+static const uint8_t btCommandListLength = (sizeof(btCommandList) / sizeof(bluetoothCommand));
+
+static const uint8_t btBatchListSize = 16;
+
+static uint8_t btBatchList[(uint16_t)(btBatchListSize)]; // variable characters of the MQ or MS command being processed
+static uint8_t btBatchCount;
+static uint8_t btBatchSetFlag;
+
+static const uint8_t btListInputLimit = 64; // an MQ, MS, or MP list read in past this many characters has lost its ;
+static uint8_t btListInputCount;
+
+static const uint8_t btSubscribeListSize = 12;
+
+static bluetoothSubscription btSubscribeList[(uint16_t)(btSubscribeListSize)];
+static uint8_t btSubscribeCount;
+static uint8_t btSubscribeIdx; // next subscription to be checked during the current push output pass
+
+static const uint8_t btsFlagNotSent =			0b10000000; // subscribed variable has not been sent yet, so send it regardless of its value
 
 static uint8_t btDelayFlag;
 static uint8_t btOutputState;
@@ -91,8 +235,9 @@ static const uint8_t btoFlagSingleShotOutput =	0b01000000;
 static const uint8_t btoFlagContinuousOutput =	0b00100000;
 static const uint8_t btoFlagDelay =				0b00010000;
 static const uint8_t btoFlagFlushBuffer =		0b00001000;
+static const uint8_t btoFlagPushOutput =		0b00000100;
 
-static const uint8_t btoOutputFlags =			(btoFlagActiveOutput | btoFlagSingleShotOutput | btoFlagContinuousOutput | btoFlagDelay | btoFlagFlushBuffer);
+static const uint8_t btoOutputFlags =			(btoFlagActiveOutput | btoFlagSingleShotOutput | btoFlagContinuousOutput | btoFlagDelay | btoFlagFlushBuffer | btoFlagPushOutput);
 static const uint8_t btoOutputEnabledFlags =	(btoFlagSingleShotOutput | btoFlagContinuousOutput);
 static const uint8_t btoOutputActiveFlags =		(btoFlagActiveOutput | btoFlagDelay | btoFlagFlushBuffer);
 
@@ -144,4 +289,9 @@ static const bluetoothFunction btFunctionList[] PROGMEM = {
 
 static const uint8_t btFunctionListLength = (sizeof(btFunctionList) / sizeof(bluetoothFunction));
 
+static const uint8_t btFuncCharFirst = '!';
+static const uint8_t btFuncCharCount = 'Z' - btFuncCharFirst + 1;
+
+static uint8_t btFunctionIndex[(uint16_t)(btFuncCharCount)]; // btFunctionList position + 1 of each variable character, or 0 if none - built by bluetooth::init
+
 #endif // defined(useBluetooth)
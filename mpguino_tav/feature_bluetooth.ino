@@ -48,7 +48,12 @@ static void bluetooth::init(void)
 	devBluetooth.controlFlags &= ~(odvFlagCRLF);
 
 #endif // defined(useBluetoothAdaFruitSPI)
-	btInputState = 0;
+	for (uint8_t x = 0; x < btFunctionListLength; x++) // build variable character lookup table
+		btFunctionIndex[(uint16_t)(pgm_read_byte(&btFunctionList[(uint16_t)(x)].btFuncChar) - btFuncCharFirst)] = x + 1;
+
+	btInputState = btiIdle;
+	btBatchSetFlag = 0;
+	btSubscribeCount = 0;
 	btOutputState = btoFlagContinuousOutput;
 	btOutputListIdx = btolTripFunctionIdx;
 
@@ -72,7 +77,7 @@ static void bluetooth::shutdown(void)
 	SREG = oldSREG; // restore interrupt flag status
 
 #endif // defined(useBluetoothAdaFruitSPI)
-	btInputState = 0;
+	btInputState = btiIdle;
 	btOutputState = 0;
 
 }
@@ -90,11 +95,16 @@ static uint8_t bluetooth::chrIn(void)
 static uint16_t bluetooth::findFormat(uint8_t inpChar)
 {
 
-	for (uint8_t x = 0; x < btFunctionListLength; x++)
+	uint8_t i;
+
+	inpChar -= btFuncCharFirst;
+
+	if (inpChar < btFuncCharCount) // if this character is in the range of variable characters
 	{
 
-		if (pgm_read_byte(&btFunctionList[(uint16_t)(x)].btFuncChar) == inpChar) // if output format char was found
-			return pgm_read_word(&btFunctionList[(uint16_t)(x)].btFuncFormat); // return the corresponding output format
+		i = btFunctionIndex[(uint16_t)(inpChar)];
+
+		if (i) return pgm_read_word(&btFunctionList[(uint16_t)(i - 1)].btFuncFormat); // if output format char was found, return the corresponding output format
 
 	}
 
@@ -106,8 +116,7 @@ static void bluetooth::mainProcess(void)
 {
 
 	uint8_t btChar;
-	uint16_t btFormat;
-	union union_16 * btF = (union union_16 *)(&btFormat);
+	btInputFunc inputHandler;
 
 	do
 	{
@@ -121,250 +130,614 @@ static void bluetooth::mainProcess(void)
 			if (peek & peekBluetoothInput) text::charOut(devDebugTerminal, btChar);
 
 #endif // defined(useDebugTerminal)
-			switch (btInputState)
-			{
+			if (btInputState < btiStateCount) inputHandler = (btInputFunc)(pgm_read_word(&btInputHandlerList[(uint16_t)(btInputState)]));
+			else inputHandler = inputNumber; // K-delimited string processing
 
-				case 'M':	// processing an expanded command
-					switch (btChar)
-					{
+			btInputState = inputHandler(btChar);
 
-						case 'M':	// output selected EEPROM parameter list
-							heart::changeBitFlags(timer0Command, 0, t0cResetBluetoothOutput); // reset bluetooth output
+		}
 
-							while (timer0Command & t0cResetBluetoothOutput); // wait for timer0 to acknowledge reset
+	}
+	while (btChar);
 
-							btOutputState &= ~(btoOutputFlags); // clear all output flags
-							btOutputState |= (btoFlagSingleShotOutput);
-							btOutputListIdx = btolParameterIdx;
-							break;
+#if defined(bluetoothSerialBuffer)
+	if (btOutputState & btoFlagFlushBuffer) // flush the output ring buffer
+	{
 
-						case 'R':	// reset current trip
-							tripSupport::doResetTrip(0);
-#if defined(useSavedTrips)
-							tripSave::doWriteTrip(0);
-#endif // defined(useSavedTrips)
-							break;
+		if (bluetoothSerialBuffer.status & bufferIsEmpty) // if the output ring buffer is flushed
+		{
 
-						case 'T':	// reset tank trip
-							tripSupport::doResetTrip(1);
-#if defined(useSavedTrips)
-							tripSave::doWriteTrip(1);
-#endif // defined(useSavedTrips)
-							break;
+			btOutputState &= ~(btoFlagFlushBuffer);
+			btDelayFlag = heart::delay0(delay0020msTick); // set for a 20 ms delay
+			btOutputState |= (btoFlagDelay); // allows smartphone app time to process variable just transmitted
 
-						default:	// unsupported command
-							break;
+		}
 
-					}
+	}
 
-					btInputState = 0;
-					break;
+#endif // defined(bluetoothSerialBuffer)
+	if (btOutputState & btoFlagDelay) // check if output delay is finished
+	{
 
-				case '!':
-					switch (btChar)
-					{
+		if ((timer0DelayFlags & btDelayFlag) == 0) btOutputState &= ~(btoFlagDelay); // if delay is finished, allow output to continue
 
-						case '!':
-							heart::changeBitFlags(timer0Command, 0, t0cResetBluetoothOutput); // reset bluetooth output
+	}
 
-							while (timer0Command & t0cResetBluetoothOutput); // wait for timer0 to acknowledge reset
+	if ((btOutputState & btoOutputActiveFlags) == btoFlagActiveOutput)
+	{
 
-							btOutputState &= ~(btoOutputFlags); // clear all output flags
-							btOutputState |= (btoFlagContinuousOutput);
-							btOutputListIdx = btolTripFunctionIdx;
-							btInputState = 1; // treat this also as a variable write, with special character substituting for '!'
-							btInpBuffIdx = 0; // reset input buffer
-							break;
+		if (btOutputState & btoFlagPushOutput) pushNext(); // output next subscribed variable that is due and has changed
+		else listNext(); // output next variable of selected output list
 
-						default:	// unsupported command
-							btInputState = 0;
-							break;
+	}
 
-					}
+}
 
-					break;
+static uint8_t bluetooth::inputIdle(uint8_t btChar)
+{
 
-				case 0:		// normal command processing
-					switch (btChar)
-					{
+	switch (btChar)
+	{
 
-						case '!':	// initialize and output selected trip functions
-						case 'M':	// process expanded command
-							btInputState = btChar; // save input state
-							break;
+		case '!':	// initialize and output selected trip functions
+			return btiTripOutput;
 
-						default:	// unrecognized command - could be a variable write
-							btFormat = findFormat(btChar); // go find the corresponding output format
+		case 'M':	// process expanded command
+			return btiExpandedCommand;
 
-							if (btFormat) // if format was found, this is a variable write
-							{
+		default:	// unrecognized command - could be a variable write
+			if (findFormat(btChar)) // if format was found, this is a variable write
+			{
 
-								btInputState = btChar; // save variable character
-								btInpBuffIdx = 0; // reset input buffer
+				btInpBuffIdx = 0; // reset input buffer
+				return btChar; // save variable character
 
-							}
+			}
 
-							break;
+			break;
 
-					}
-					break;
+	}
 
-				default:	// K-delimited string processing
-					switch (btChar)
-					{
+	return btiIdle;
 
-						default:	// unrecognized character - reset number input
-							btInputState = 0;
-							break;
+}
 
-						case '0' ... '9':	// digits
-							if (btInputState & 0x80) // if in check digit mode, and read in digit does not equal stored digit, abort
-							{
+static uint8_t bluetooth::inputExpandedCommand(uint8_t btChar)
+{
 
-								if (btChar != btInpBuff[(uint16_t)(btInpBuffIdx++)]) btInputState = 0;
+	for (uint8_t x = 0; x < btCommandListLength; x++)
+	{
 
-							}
-							else // if not, we are in digit storage mode
-								btInpBuff[(uint16_t)(btInpBuffIdx++)] = btChar; // store digit
+		if (pgm_read_byte(&btCommandList[(uint16_t)(x)].btCmdChar) == btChar) // if command char was found
+			return ((btCommandFunc)(pgm_read_word(&btCommandList[(uint16_t)(x)].btCmdFunc)))(); // go perform the command
 
-							break;
+	}
 
-						case 'K':	// number string terminator
-							btInputState ^= 0x80; // toggle digit mode
+	return btiIdle; // unsupported command
 
-							if (btInputState & 0x80) btInpBuff[(uint16_t)(btInpBuffIdx)] = 0; // if in check digit mode, mark end of string
-							else // if back in digit storage mode, time to convert number string
-							{
+}
 
-								// if end of digit string is correct, then the two input digit strings are identical
-								if (btInpBuff[(uint16_t)(btInpBuffIdx)] == 0)
-								{
+static uint8_t bluetooth::inputTripOutput(uint8_t btChar)
+{
 
-									if (btInputState == 1) btChar = '!'; // re-translate back to '!' for output
-									else btChar = btInputState;
+	if (btChar == '!')
+	{
 
-									btFormat = findFormat(btChar); // go find the corresponding output format
+		resetOutput();
+		btOutputState |= (btoFlagContinuousOutput);
+		btOutputListIdx = btolTripFunctionIdx;
+		btInpBuffIdx = 0; // reset input buffer
+		return '!'; // treat this also as a variable write of '!'
 
-									if (btFormat)
-									{
+	}
 
-										switch (btF->u8[0])
-										{
+	return btiIdle; // unsupported command
 
-											case tGetBTparameterValue:
-												str2ull(btInpBuff); // convert digit string into a number
-#if defined(usePartialRefuel)
-												if (btF->u8[1] == pRefuelSizeIdx) SWEET64::runPrgm(prgmAddToPartialRefuel, 0);
-#endif // defined(usePartialRefuel)
-												parameterEdit::onEEPROMchange(prgmWriteBTparameterValue, btF->u8[1]);
-												heart::changeBitFlags(timer0Command, 0, t0cInputReceived);
-												break;
+}
 
-											case tFetchMainProgramValue:
-												str2ull(btInpBuff); // convert digit string into a number
-												SWEET64::runPrgm(prgmWriteMainProgramValue, btF->u8[1]);
-												heart::changeBitFlags(timer0Command, 0, t0cInputReceived);
-												break;
+static uint8_t bluetooth::inputBatchQuery(uint8_t btChar)
+{
 
-											default:
-												break;
+	uint8_t btState;
 
-										}
+	if (btChar == ';') // end of variable list
+	{
 
-									}
+		outputBatch();
+		return btiIdle;
 
-								}
+	}
 
-								btInputState = 0; // reset input state
+	btState = inputListCheck(btChar, btiBatchQuery);
+	if (btState != btiBatchQuery) return btState; // variable list was not ended properly - drop it
 
-							}
+	if ((findFormat(btChar)) && (btBatchCount < btBatchListSize)) btBatchList[(uint16_t)(btBatchCount++)] = btChar; // unrecognized characters are ignored
 
-							btInpBuffIdx = 0;
+	return btiBatchQuery;
 
-							break;
+}
 
-					}
-					break;
+static uint8_t bluetooth::inputBatchSet(uint8_t btChar)
+{
 
-			}
+	uint8_t btState;
 
-		}
+	if (btChar == ';') // end of variable list
+	{
+
+		btBatchSetFlag = 0;
+		outputBatch();
+		return btiIdle;
 
 	}
-	while (btChar);
 
-#if defined(bluetoothSerialBuffer)
-	if (btOutputState & btoFlagFlushBuffer) // flush the output ring buffer
+	btState = inputListCheck(btChar, btiBatchSet);
+
+	if (btState != btiBatchSet) // variable list was not ended properly - drop it, without any response
 	{
 
-		if (bluetoothSerialBuffer.status & bufferIsEmpty) // if the output ring buffer is flushed
+		btBatchSetFlag = 0;
+		return btState;
+
+	}
+
+	if (findFormat(btChar)) // if format was found, this is a variable write
+	{
+
+		btInpBuffIdx = 0; // reset input buffer
+		return btChar; // save variable character
+
+	}
+
+	return btiBatchSet; // unrecognized characters are ignored
+
+}
+
+static uint8_t bluetooth::inputSubscribe(uint8_t btChar)
+{
+
+	bluetoothSubscription * btSub;
+	uint8_t btState;
+
+	if (btChar == ';') // end of subscription list
+	{
+
+		resetOutput(); // stop any other output in progress
+		if (btSubscribeCount) btOutputState |= (btoFlagPushOutput); // start push output with the next Bluetooth output period
+		return btiIdle;
+
+	}
+
+	btState = inputListCheck(btChar, btiSubscribe);
+
+	if (btState != btiSubscribe) // subscription list was not ended properly - keep the subscriptions read in so far
+	{
+
+		if (btSubscribeCount)
 		{
 
-			btOutputState &= ~(btoFlagFlushBuffer);
-			btDelayFlag = heart::delay0(delay0020msTick); // set for a 20 ms delay
-			btOutputState |= (btoFlagDelay); // allows smartphone app time to process variable just transmitted
+			resetOutput();
+			btOutputState |= (btoFlagPushOutput);
 
 		}
 
+		return btState;
+
 	}
 
-#endif // defined(bluetoothSerialBuffer)
-	if (btOutputState & btoFlagDelay) // check if output delay is finished
+	switch (btChar)
 	{
 
-		if ((timer0DelayFlags & btDelayFlag) == 0) btOutputState &= ~(btoFlagDelay); // if delay is finished, allow output to continue
+		case '0' ... '9':	// digits of minimum interval
+			if (btSubscribeCount)
+			{
+
+				btSub = &btSubscribeList[(uint16_t)(btSubscribeCount - 1)]; // subscription currently being read in
+
+				if (btSub->btSubInterval < 25) btSub->btSubInterval = btSub->btSubInterval * 10 + (btChar - '0');
+				else btSub->btSubInterval = 255; // limit minimum interval to what fits
+
+			}
+
+			break;
+
+		default:	// could be the next subscribed variable - 'K' and other unrecognized characters are ignored
+			if ((findFormat(btChar)) && (btSubscribeCount < btSubscribeListSize))
+			{
+
+				btSub = &btSubscribeList[(uint16_t)(btSubscribeCount++)];
+
+				btSub->btSubChar = btChar;
+				btSub->btSubInterval = 0;
+				btSub->btSubCount = 0;
+				btSub->btSubFlags = btsFlagNotSent;
+
+			}
+
+			break;
 
 	}
 
-	if ((btOutputState & btoOutputActiveFlags) == btoFlagActiveOutput)
+	return btiSubscribe;
+
+}
+
+static uint8_t bluetooth::inputListCheck(uint8_t btChar, uint8_t btState)
+{
+
+	switch (btChar)
 	{
 
-		do
-		{
+		case 'M':	// start of another command, so the ; of the list being read in was lost
+		case '!':
+			return inputIdle(btChar); // go process the start of that command
+
+		default:
+			if (btListInputCount < btListInputLimit)
+			{
+
+				btListInputCount++;
+				return btState; // continue reading in list
+
+			}
+
+			break;
 
-			btChar = pgm_read_byte(btOutputString++); // read in a character of output list
+	}
 
-			if (btChar)  // if this is a valid character
+	return btiIdle; // list is longer than any valid one, so its ; was lost
+
+}
+
+#if defined(useParameterTransfer)
+static uint8_t bluetooth::inputParameterFrame(uint8_t btChar)
+{
+
+	uint8_t btFrameStatus;
+
+	btFrameStatus = paramTransfer::importChar(btChar);
+
+	if (btFrameStatus == ptsBusy) return btiParameterFrame;
+
+	paramTransfer::statusOut(devBluetooth, btFrameStatus);
+
+	return btiIdle;
+
+}
+
+#endif // defined(useParameterTransfer)
+static uint8_t bluetooth::inputNumber(uint8_t btChar)
+{
+
+	uint16_t btFormat;
+	union union_16 * btF = (union union_16 *)(&btFormat);
+
+	switch (btChar)
+	{
+
+		case '0' ... '9':	// digits
+			if (btInpBuffIdx < (sizeof(btInpBuff) - 1)) // leave room for the end of string marker
 			{
 
-				btFormat = findFormat(btChar); // go find the corresponding output format
+				if (btInputState & btiCheckDigits) // if in check digit mode, and read in digit does not equal stored digit, abort
+				{
+
+					if (btChar == btInpBuff[(uint16_t)(btInpBuffIdx++)]) return btInputState;
 
-				if (btFormat) // if this is a valid format
+				}
+				else // if not, we are in digit storage mode
 				{
 
-					text::charOut(devBluetooth, btChar); // output character corresponding to output format
+					btInpBuff[(uint16_t)(btInpBuffIdx++)] = btChar; // store digit
+					return btInputState;
 
-					if ((btF->u8[1] == instantIdx) && (btF->u8[0] == tFuelEcon)) // check if swap with fuel consumption rate is needed
-					{
+				}
 
-						if (SWEET64::runPrgm(prgmCheckInstantSpeed, 0) == 0) btF->u8[0] = tFuelRate;
+			}
 
-					}
+			break;
 
-					btChar = ((btF->u8[0] < dfMaxValDisplayCount) ? 7 : 10);
+		case 'K':	// number string terminator
+			btChar = btInpBuffIdx;
+			btInpBuffIdx = 0;
 
-					text::tripFunctionOut(devBluetooth, btFormat, btChar, (dfOutputBluetooth));
+			if ((btInputState & btiCheckDigits) == 0) // if in digit storage mode, mark end of string and switch to check digit mode
+			{
 
-#if defined(bluetoothSerialBuffer)
-					btOutputState |= (btoFlagFlushBuffer);
+				btInpBuff[(uint16_t)(btChar)] = 0;
+				return (btInputState | btiCheckDigits);
 
-#else // defined(bluetoothSerialBuffer)
-					btDelayFlag = heart::delay0(delay0020msTick); // set for a 20 ms delay
-					btOutputState |= (btoFlagDelay); // allows smartphone app time to process variable just transmitted
+			}
 
-#endif // defined(bluetoothSerialBuffer)
-				}
+			// if end of digit string is correct, then the two input digit strings are identical
+			if (btInpBuff[(uint16_t)(btChar)]) break;
+
+			btChar = (btInputState & ~(btiCheckDigits)); // retrieve variable character
+			btFormat = findFormat(btChar); // go find the corresponding output format
+
+			switch (btF->u8[0])
+			{
+
+				case tGetBTparameterValue:
+					str2ull(btInpBuff); // convert digit string into a number
+#if defined(usePartialRefuel)
+					if (btF->u8[1] == pRefuelSizeIdx) SWEET64::runPrgm(prgmAddToPartialRefuel, 0);
+#endif // defined(usePartialRefuel)
+					parameterEdit::onEEPROMchange(prgmWriteBTparameterValue, btF->u8[1]);
+					heart::changeBitFlags(timer0Command, 0, t0cInputReceived);
+					break;
+
+				case tFetchMainProgramValue:
+					str2ull(btInpBuff); // convert digit string into a number
+					SWEET64::runPrgm(prgmWriteMainProgramValue, btF->u8[1]);
+					heart::changeBitFlags(timer0Command, 0, t0cInputReceived);
+					break;
+
+				default:
+					break;
+
+			}
+
+			if ((btBatchSetFlag) && (btBatchCount < btBatchListSize)) btBatchList[(uint16_t)(btBatchCount++)] = btChar; // add stored variable to MS response
+
+			return (btBatchSetFlag ? btiBatchSet : btiIdle);
+
+		default:	// unrecognized character - reset number input
+			if (btBatchSetFlag) return inputBatchSet(btChar); // this may be the next variable of a MS command, or its end
+			break;
+
+	}
+
+	return (btBatchSetFlag ? btiBatchSet : btiIdle); // abort number input
+
+}
+
+static uint8_t bluetooth::cmdOutputParameters(void)
+{
+
+	resetOutput();
+	btOutputState |= (btoFlagSingleShotOutput);
+	btOutputListIdx = btolParameterIdx;
+
+	return btiIdle;
+
+}
+
+static uint8_t bluetooth::cmdResetCurrent(void)
+{
+
+	tripSupport::doResetTrip(0);
+#if defined(useSavedTrips)
+	tripSave::doWriteTrip(0);
+#endif // defined(useSavedTrips)
+
+	return btiIdle;
+
+}
+
+static uint8_t bluetooth::cmdResetTank(void)
+{
+
+	tripSupport::doResetTrip(1);
+#if defined(useSavedTrips)
+	tripSave::doWriteTrip(1);
+#endif // defined(useSavedTrips)
+
+	return btiIdle;
+
+}
+
+static uint8_t bluetooth::cmdBatchQuery(void)
+{
+
+	btBatchCount = 0;
+	btListInputCount = 0;
+
+	return btiBatchQuery;
+
+}
+
+static uint8_t bluetooth::cmdBatchSet(void)
+{
+
+	btBatchCount = 0;
+	btListInputCount = 0;
+	btBatchSetFlag = 1;
+
+	return btiBatchSet;
+
+}
+
+static uint8_t bluetooth::cmdSubscribe(void)
+{
+
+	if (btOutputState & btoFlagPushOutput) btOutputState &= ~(btoFlagPushOutput | btoFlagActiveOutput); // stop push output of the old subscription list
+	btSubscribeCount = 0;
+	btListInputCount = 0;
+
+	return btiSubscribe;
+
+}
+
+#if defined(useParameterTransfer)
+static uint8_t bluetooth::cmdExportParameters(void)
+{
+
+	uint8_t btOutputMode;
+
+	btOutputMode = (btOutputState & (btoFlagContinuousOutput | btoFlagPushOutput)); // remember which repeating output was running
+
+	resetOutput(); // stop trip function output, so it does not end up in the middle of the frame
+	paramTransfer::exportFrame(devBluetooth);
+
+	btOutputState |= (btOutputMode); // resume that output with the next Bluetooth output period
+	holdOutput(); // give smartphone app time to process the frame first
+
+	return btiIdle;
+
+}
+
+static uint8_t bluetooth::cmdImportParameters(void)
+{
+
+	paramTransfer::importReset();
+
+	return btiParameterFrame;
+
+}
+
+#endif // defined(useParameterTransfer)
+static void bluetooth::resetOutput(void)
+{
+
+	heart::changeBitFlags(timer0Command, 0, t0cResetBluetoothOutput); // reset bluetooth output
+
+	while (timer0Command & t0cResetBluetoothOutput); // wait for timer0 to acknowledge reset
+
+	btOutputState &= ~(btoOutputFlags); // clear all output flags
+
+}
+
+static uint16_t bluetooth::valueFormat(uint8_t btChar)
+{
+
+	uint16_t btFormat;
+	union union_16 * btF = (union union_16 *)(&btFormat);
+
+	btFormat = findFormat(btChar); // go find the corresponding output format
+
+	if ((btF->u8[1] == instantIdx) && (btF->u8[0] == tFuelEcon)) // check if swap with fuel consumption rate is needed
+	{
+
+		if (SWEET64::runPrgm(prgmCheckInstantSpeed, 0) == 0) btF->u8[0] = tFuelRate;
+
+	}
+
+	return btFormat;
+
+}
+
+static uint8_t bluetooth::outputValue(uint8_t btChar)
+{
+
+	uint16_t btFormat;
+	union union_16 * btF = (union union_16 *)(&btFormat);
+
+	btFormat = valueFormat(btChar); // go find the corresponding output format
+
+	if (btFormat) // if this is a valid format
+	{
+
+		text::charOut(devBluetooth, btChar); // output character corresponding to output format
+
+		btChar = ((btF->u8[0] < dfMaxValDisplayCount) ? 7 : 10);
+
+		text::tripFunctionOut(devBluetooth, btFormat, btChar, (dfOutputBluetooth));
+
+		return 1;
+
+	}
+
+	return 0;
+
+}
+
+static void bluetooth::listNext(void)
+{
+
+	uint8_t btChar;
+
+	do
+	{
+
+		btChar = pgm_read_byte(btOutputString++); // read in a character of output list
+
+		if (btChar)  // if this is a valid character
+		{
+
+			if (outputValue(btChar)) // if this is a valid format
+			{
+
+				holdOutput(); // allow smartphone app time to process variable just transmitted
+				btChar = 0;
 
 			}
-			else btOutputState &= ~(btoFlagActiveOutput); // finished outputting list
 
 		}
-		while ((btChar) && (btFormat == 0)); // loop back if we found a valid character but an invalid format for that character
+		else btOutputState &= ~(btoFlagActiveOutput); // finished outputting list
 
 	}
+	while (btChar); // loop back if we found a valid character but an invalid format for that character
 
 }
 
+static void bluetooth::pushNext(void)
+{
+
+	bluetoothSubscription * btSub;
+	uint16_t btFormat;
+	union union_16 * btF = (union union_16 *)(&btFormat);
+
+	while (btSubscribeIdx < btSubscribeCount)
+	{
+
+		btSub = &btSubscribeList[(uint16_t)(btSubscribeIdx++)];
+
+		if (btSub->btSubCount == 0) // if minimum interval has passed since this variable was last sent
+		{
+
+			btFormat = valueFormat(btSub->btSubChar);
+
+			translateCalcIdx(btFormat, ((btF->u8[0] < dfMaxValDisplayCount) ? 7 : 10), (dfOutputBluetooth));
+
+			if ((btSub->btSubFlags & btsFlagNotSent) || (mainCalcFuncVar.value != btSub->btSubLastValue))
+			{
+
+				btSub->btSubFlags &= ~(btsFlagNotSent);
+				btSub->btSubLastValue = mainCalcFuncVar.value;
+				btSub->btSubCount = btSub->btSubInterval;
+
+				outputValue(btSub->btSubChar);
+				holdOutput(); // allow smartphone app time to process variable just transmitted
+
+				return;
+
+			}
+
+		}
+
+	}
+
+	btOutputState &= ~(btoFlagActiveOutput); // finished this push output pass
+
+}
+
+static void bluetooth::outputBatch(void)
+{
+
+	text::charOut(devBluetooth, '<');
+
+	for (uint8_t x = 0; x < btBatchCount; x++) outputValue(btBatchList[(uint16_t)(x)]); // all requested variables go out in one response, without any delay between them
+
+	text::charOut(devBluetooth, '>');
+
+	holdOutput(); // give smartphone app time to process the response before any list output resumes
+
+}
+
+static void bluetooth::holdOutput(void)
+{
+
+#if defined(bluetoothSerialBuffer)
+	btOutputState |= (btoFlagFlushBuffer);
+
+#else // defined(bluetoothSerialBuffer)
+	btDelayFlag = heart::delay0(delay0020msTick); // set for a 20 ms delay
+	btOutputState |= (btoFlagDelay); // allows smartphone app time to process variable just transmitted
+
+#endif // defined(bluetoothSerialBuffer)
+}
+
 static void bluetooth::mainOutput(void)
 {
 
@@ -373,7 +746,22 @@ static void bluetooth::mainOutput(void)
 
 		heart::changeBitFlags(activityFlags, afBluetoothOutput, 0); // acknowledge update bluetooth output command
 
-		if ((btOutputState & btoOutputEnabledFlags) && ((btOutputState & btoFlagActiveOutput) == 0))
+		if (btOutputState & btoFlagPushOutput)
+		{
+
+			for (uint8_t x = 0; x < btSubscribeCount; x++) // count down minimum interval of each subscribed variable, every period
+				if (btSubscribeList[(uint16_t)(x)].btSubCount) btSubscribeList[(uint16_t)(x)].btSubCount--;
+
+			if ((btOutputState & btoFlagActiveOutput) == 0) // start the next push output pass only once the previous one is finished
+			{
+
+				btSubscribeIdx = 0;
+				btOutputState |= (btoFlagActiveOutput); // enable bluetooth::mainProcess push output
+
+			}
+
+		}
+		else if ((btOutputState & btoOutputEnabledFlags) && ((btOutputState & btoFlagActiveOutput) == 0))
 		{
 
 			btOutputState &= ~(btoFlagSingleShotOutput); // clear single-shot flag
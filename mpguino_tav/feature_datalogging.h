@@ -1,5 +1,48 @@
+#if (defined(useDataLoggingOutput) || defined(useJSONoutput)) && defined(useBuffering)
+static const uint16_t outputRecordStartSpace = 24; // a record part only starts once its output buffer has at least this much room
+
+#endif // (defined(useDataLoggingOutput) || defined(useJSONoutput)) && defined(useBuffering)
+#if defined(useLogRecordStamps)
+namespace logStamp /* record sequence number and timestamp support section prototype */
+{
+
+	static uint32_t milliseconds(void);
+	static void numberOut(interfaceDevice &dev, uint32_t value);
+
+};
+
+// each data logging line starts with "sequence,milliseconds," and each JSON payload's first graph object starts with
+//    "seq" and "ms" keys
+//
+// sequence numbers count up by one for every record actually sent on that port, and wrap from 65535 back to 0, so any
+//    gap in the sequence means records were lost on the way to the host
+//
+// timestamps are milliseconds since power-up, taken from the timer0 cycle counter, and wrap after about 49 days
+//
+static const uint16_t logStampCyclesPerMillisecond = (uint16_t)(t0CyclesPerSecond / 1000ul);
+
+static uint32_t logStampMilliseconds;
+static uint32_t logStampLastCycle;
+#if defined(useDataLoggingOutput)
+static uint16_t dataLogSequence;
+#endif // defined(useDataLoggingOutput)
+#if defined(useJSONoutput)
+static uint16_t JSONsequence;
+#endif // defined(useJSONoutput)
+
+#endif // defined(useLogRecordStamps)
 #if defined(useDataLoggingOutput)
 static void doOutputDataLog(void);
+static void doOutputDataLogStep(void);
+
+// a data logging line goes out one part at a time - the record stamps first, then one field per part - so that a slow
+//    port only stretches the line out in time, instead of stalling the main loop until the whole line fits in the
+//    output buffer. No part is longer than outputRecordStartSpace
+static uint8_t dataLogStep; // next part of the data logging line to output, or 0 if no line is in progress
+static uint8_t dataLogFieldCount;
+#if defined(useDataLogDelta)
+static uint8_t dataLogSendFields; // bit mask of those fields that the line in progress carries
+#endif // defined(useDataLogDelta)
 
 static const uint16_t dataLogTripCalcFormats[] PROGMEM = {
 	 ((instantIdx << 8) |	 	tFuelEcon)				// average fuel economy  for the past loop
@@ -11,6 +54,110 @@ static const uint16_t dataLogTripCalcFormats[] PROGMEM = {
 
 static const uint8_t dLIcount = (sizeof(dataLogTripCalcFormats) / sizeof(uint16_t));
 
+static uint8_t dataLogGetFieldCount(void);
+static uint16_t dataLogGetField(uint8_t fieldIdx);
+
+#if defined(useDataLogFieldList)
+static void dataLogResetFields(void);
+static uint16_t dataLogGetFieldSignature(uint8_t fieldCount);
+
+// the data logging field list lives in EEPROM, and starts out as a copy of dataLogTripCalcFormats above
+// each field is a (trip index << 8 | function index) word, exactly like a screen editor page format. The list ends at
+//    the first field with an invalid trip index or function index, or after dataLogFieldListSize fields
+// a data logging line is sent every pDataLogDividerIdx samples
+static const uint8_t dLImaxCount = dataLogFieldListSize;
+
+static uint8_t dataLogDividerCount;
+
+#else // defined(useDataLogFieldList)
+static const uint8_t dLImaxCount = dLIcount;
+
+#endif // defined(useDataLogFieldList)
+#if defined(useDataLogDelta)
+static uint8_t dataLogChangedFields(uint8_t fieldCount, uint8_t threshold);
+
+// with a non-zero change threshold, a data logging line only carries the fields whose value moved by more than that
+//    percentage since it was last sent - unchanged fields are left empty, and a line with no changed fields is not sent
+// a full line is sent regardless once every dataLogKeyframeInterval samples, and whenever the field list changes, so a
+//    host can always resynchronize. The interval counts samples rather than lines, so it stays at 30 seconds no matter
+//    what pDataLogDividerIdx is set to
+static const uint8_t dataLogKeyframeInterval = 30 * loopsPerSecond; // 30 seconds' worth of samples
+
+static uint32_t dataLogLastValue[(uint16_t)(dLImaxCount)];
+static uint8_t dataLogKeyframeCount; // samples left before the next full line
+#if defined(useDataLogFieldList)
+static uint16_t dataLogLastSignature; // CRC of the field list that the last line carried
+#endif // defined(useDataLogFieldList)
+
+#endif // defined(useDataLogDelta)
+
+#if defined(useFuelLog)
+static const uint8_t fuelLogExportCalcs[] PROGMEM = {
+	 tDistance
+	,tFuelUsed
+	,tFuelEcon
+	,tEngineRunTime
+};
+
+#endif // defined(useFuelLog)
+#if defined(useBinaryLogging)
+namespace binaryLog /* binary telemetry support section prototype */
+{
+
+	static void outputRecord(interfaceDevice &dev, uint8_t streamIdx);
+	static uint8_t startRecord(uint8_t recordType, uint8_t streamIdx);
+	static void encodeFrame(uint8_t streamIdx, uint8_t length);
+	static void outputStep(interfaceDevice &dev, uint8_t streamIdx);
+
+};
+
+// binary telemetry is an alternative to the comma-separated and JSON output formats, carrying the same trip functions
+//    as the data logging output in a fraction of the bytes
+//
+// before framing, each record is a record type byte, a sequence number, the record body, and a big-endian CRC-16
+//    (CCITT polynomial, initial value 0xFFFF) of everything before it
+//
+// schema record body - format version, field count, metric mode flag, samples per second, samples per record, then
+//    trip index, function index, and decimal places for each field. Records go out at samples per second divided by
+//    samples per record
+//
+// data record body - each field, as an unsigned 32-bit little-endian value scaled by 1000. A value that does not fit
+//    in 32 bits is sent as 0xFFFFFFFF.
+//
+// each record is then framed with Consistent Overhead Byte Stuffing (COBS), and terminated with a zero byte. A zero
+//    byte never appears anywhere else, so a host can resynchronize at the next zero byte after any lost data.
+//
+// each stream has its own frame buffer. A record is built one byte in from the start of its frame buffer, and COBS
+//    encoded in place - with records shorter than 254 bytes, every zero byte simply becomes the next code byte. The
+//    frame then goes out only as fast as the output buffer empties, and a new record is skipped while the previous
+//    frame is still going out
+//
+// a schema record is sent instead of the first data record, and then every blSchemaInterval records after that
+//
+static const uint8_t blRecordSchema =			0x01;
+static const uint8_t blRecordData =				0x02;
+
+static const uint8_t blFormatVersion =			2;
+static const uint8_t blSchemaInterval =			16;
+
+static const uint8_t blStreamLogging =			0;
+static const uint8_t blStreamJSON =				1;
+static const uint8_t blStreamCount =			2;
+
+static const uint8_t blSchemaRecordLength =		2 + 5 + 3 * dLImaxCount;	// header, schema info, field descriptions
+static const uint8_t blDataRecordLength =		2 + 4 * dLImaxCount;		// header, field values
+static const uint8_t blBufferLength =			1 + ((blSchemaRecordLength > blDataRecordLength) ? blSchemaRecordLength : blDataRecordLength) + 2 + 1; // code byte, record, CRC, frame end
+
+static uint8_t blBuffer[(uint16_t)(blStreamCount)][(uint16_t)(blBufferLength)];
+static uint8_t blFrameLength[(uint16_t)(blStreamCount)]; // length of frame still going out, or 0 if there is none
+static uint8_t blFrameIdx[(uint16_t)(blStreamCount)];
+static uint8_t blSequence[(uint16_t)(blStreamCount)];
+static uint8_t blSchemaCountdown[(uint16_t)(blStreamCount)];
+#if defined(useDataLogFieldList)
+static uint16_t blFieldSignature[(uint16_t)(blStreamCount)]; // CRC of the field list and divider that the last schema record described
+#endif // defined(useDataLogFieldList)
+
+#endif // defined(useBinaryLogging)
 #endif // defined(useDataLoggingOutput)
 #if defined(useJSONoutput)
 namespace JSONsupport /* JSON formatting support section prototype */
@@ -31,6 +178,7 @@ namespace JSONsupport /* JSON formatting support section prototype */
 };
 
 static uint8_t JSONlevel;
+static uint8_t JSONstep; // next part of the JSON payload to output, or 0 if no payload is in progress
 static uint8_t JSONflag[16];
 
 static const uint8_t JSONflagArray =		0b10000000;
@@ -47,6 +195,7 @@ static void doOutputJSONnumber(uint32_t an, uint8_t decimalPlaces, const char *
 static void doOutputJSONfuelEcon(const char * prefixStr, uint8_t tripIdx);
 static void doOutputJSONremainingFuel(void);
 static void doOutputJSON(void);
+static void doOutputJSONstep(void);
 
 static const char tripStr[] PROGMEM = {
 	"trip " tcEOS
@@ -80,4 +229,15 @@ static const char JSONmarkersStr[] PROGMEM = {
 	"markers" tcEOS
 };
 
+#if defined(useLogRecordStamps)
+static const char JSONsequenceStr[] PROGMEM = {
+	"seq" tcEOS
+};
+
+static const char JSONmillisecondsStr[] PROGMEM = {
+	"ms" tcEOS
+};
+
+#endif // defined(useLogRecordStamps)
+
 #endif // defined(useJSONoutput)
@@ -1,22 +1,441 @@
+#if defined(useLogRecordStamps)
+/* record sequence number and timestamp support section */
+
+// returns milliseconds since power-up. The leftover fraction of a millisecond stays in logStampLastCycle, so no time is
+//    lost between calls. This must be called at least once every 4.7 hours, before the timer0 cycle counter wraps
+static uint32_t logStamp::milliseconds(void)
+{
+
+	uint32_t elapsed;
+
+	elapsed = (heart::cycles0() - logStampLastCycle) / logStampCyclesPerMillisecond;
+
+	logStampLastCycle += elapsed * logStampCyclesPerMillisecond;
+	logStampMilliseconds += elapsed;
+
+	return logStampMilliseconds;
+
+}
+
+static void logStamp::numberOut(interfaceDevice &dev, uint32_t value)
+{
+
+	SWEET64::init64((union union_64 *)(&s64reg[s64reg2]), value);
+	text::stringOut(dev, ull2str(nBuff, 0, tFormatToNumber));
+
+}
+
+#endif // defined(useLogRecordStamps)
 #if defined(useDataLoggingOutput)
 static void doOutputDataLog(void)
 {
 
-	uint8_t c = ',';
+#if defined(useDataLogDelta)
+	uint8_t threshold;
+#if defined(useDataLogFieldList)
+	uint16_t signature;
+#endif // defined(useDataLogFieldList)
+
+	if (dataLogKeyframeCount) dataLogKeyframeCount--; // count every sample, including those that pDataLogDividerIdx skips
+
+#endif // defined(useDataLogDelta)
+#if defined(useDataLogFieldList)
+	if (dataLogDividerCount)
+	{
+
+		dataLogDividerCount--;
+		return; // not this sample
+
+	}
+
+	dataLogDividerCount = EEPROM::readByte(pDataLogDividerIdx);
+	if (dataLogDividerCount) dataLogDividerCount--;
+
+#endif // defined(useDataLogFieldList)
+#if defined(useBinaryLogging)
+	if (EEPROM::readByte(pSerialDataLoggingIdx) == 2)
+	{
+
+		binaryLog::outputRecord(devLogOutput, blStreamLogging);
+		return;
+
+	}
+
+#endif // defined(useBinaryLogging)
+	if (dataLogStep) return; // the previous line is still going out, so skip this one rather than stall
+
+	dataLogFieldCount = dataLogGetFieldCount();
+
+	if (dataLogFieldCount == 0) return; // nothing to send
+
+#if defined(useDataLogDelta)
+	dataLogSendFields = 0xFF;
+
+#if defined(useDataLogFieldList)
+	signature = dataLogGetFieldSignature(dataLogFieldCount);
+
+	if (signature != dataLogLastSignature) // if the field list has changed, the last sent values no longer match up with the fields
+	{
+
+		dataLogLastSignature = signature;
+		dataLogKeyframeCount = 0; // so send every field right away
+
+	}
+
+#endif // defined(useDataLogFieldList)
+	threshold = EEPROM::readByte(pDataLogDeltaIdx);
+
+	if (threshold)
+	{
+
+		// find out which fields have changed enough to be worth sending
+		if (dataLogKeyframeCount) dataLogSendFields = dataLogChangedFields(dataLogFieldCount, threshold);
+		else dataLogKeyframeCount = dataLogKeyframeInterval; // send every field this time
+
+		if (dataLogSendFields == 0) return; // nothing worth sending
+
+	}
+
+#endif // defined(useDataLogDelta)
+	dataLogStep = 1;
+
+	doOutputDataLogStep(); // start sending the line right away, and let the main loop send whatever does not fit yet
+
+}
+
+// outputs as many parts of the data logging line in progress as the output buffer has room for
+static void doOutputDataLogStep(void)
+{
+
+	uint8_t x;
+
+	while (dataLogStep)
+	{
+
+#if defined(useBuffering)
+		if (text::freeSpace(devLogOutput) < outputRecordStartSpace) return; // wait for the output buffer to drain some more
+
+#endif // defined(useBuffering)
+		x = dataLogStep++;
+
+		if (x == 1)
+		{
+
+#if defined(useLogRecordStamps)
+			logStamp::numberOut(devLogOutput, dataLogSequence++);
+			text::charOut(devLogOutput, ',');
+			logStamp::numberOut(devLogOutput, logStamp::milliseconds());
+			text::charOut(devLogOutput, ',');
+
+#endif // defined(useLogRecordStamps)
+		}
+		else
+		{
+
+			x -= 2; // find field index
+
+#if defined(useDataLogDelta)
+			if (dataLogSendFields & (1 << x))
+			{
+
+				// perform the required decimal formatting, and output the number
+				text::tripFunctionOut(devLogOutput, dataLogGetField(x), 0, (dfOverflow9s));
+				dataLogLastValue[(uint16_t)(x)] = mainCalcFuncVar.value;
+
+			}
+
+#else // defined(useDataLogDelta)
+			// perform the required decimal formatting, and output the number
+			text::tripFunctionOut(devLogOutput, dataLogGetField(x), 0, (dfOverflow9s));
+
+#endif // defined(useDataLogDelta)
+			x++;
+
+			if (x < dataLogFieldCount) text::charOut(devLogOutput, ',');
+			else
+			{
+
+				text::charOut(devLogOutput, '\n');
+				dataLogStep = 0; // line is complete
+
+			}
+
+		}
+
+	}
+
+}
+
+static uint8_t dataLogGetFieldCount(void)
+{
+
+#if defined(useDataLogFieldList)
+	uint16_t tripCalc;
+	uint8_t x;
+
+	for (x = 0; x < dataLogFieldListSize; x++)
+	{
+
+		tripCalc = dataLogGetField(x);
+
+		if (((uint8_t)(tripCalc >> 8) >= tripSlotCount) || ((uint8_t)(tripCalc) >= dfMaxValDisplayCount)) break; // an invalid field ends the list
+
+	}
+
+	return x;
+#else // defined(useDataLogFieldList)
+	return dLIcount;
+#endif // defined(useDataLogFieldList)
+
+}
+
+static uint16_t dataLogGetField(uint8_t fieldIdx)
+{
+
+#if defined(useDataLogFieldList)
+	return EEPROM::readWord(fieldIdx + eePtrDataLogFieldsStart);
+#else // defined(useDataLogFieldList)
+	return pgm_read_word(&dataLogTripCalcFormats[(uint16_t)(fieldIdx)]);
+#endif // defined(useDataLogFieldList)
+
+}
+
+#if defined(useDataLogFieldList)
+static void dataLogResetFields(void)
+{
+
+	uint8_t t = eePtrDataLogFieldsStart;
+
+	for (uint8_t x = 0; x < dataLogFieldListSize; x++)
+		if (x < dLIcount) EEPROM::writeVal(t++, (uint32_t)(pgm_read_word(&dataLogTripCalcFormats[(uint16_t)(x)])));
+		else EEPROM::writeVal(t++, 0xFFFF); // mark the rest of the list as unused
+
+}
+
+// returns a CRC of the field list, so that any change to it can be spotted
+static uint16_t dataLogGetFieldSignature(uint8_t fieldCount)
+{
+
+	uint16_t tripCalc;
+	uint16_t signature;
+
+	signature = 0xFFFF;
+
+	for (uint8_t x = 0; x < fieldCount; x++)
+	{
+
+		tripCalc = dataLogGetField(x);
+		signature = _crc_ccitt_update(signature, (uint8_t)(tripCalc >> 8));
+		signature = _crc_ccitt_update(signature, (uint8_t)(tripCalc));
+
+	}
+
+	return signature;
+
+}
+
+#endif // defined(useDataLogFieldList)
+#if defined(useDataLogDelta)
+// returns a bit mask of those fields whose value differs from the one last sent by more than threshold percent
+static uint8_t dataLogChangedFields(uint8_t fieldCount, uint8_t threshold)
+{
+
+	uint32_t lastValue;
+	uint32_t delta;
+	uint8_t changedFields = 0;
+
+	for (uint8_t x = 0; x < fieldCount; x++)
+	{
+
+		translateCalcIdx(dataLogGetField(x), 0, (dfOverflow9s));
+
+		lastValue = dataLogLastValue[(uint16_t)(x)];
+
+		if (mainCalcFuncVar.value > lastValue) delta = mainCalcFuncVar.value - lastValue;
+		else delta = lastValue - mainCalcFuncVar.value;
+
+		if (delta == 0) continue; // field has not changed at all
+
+		if (lastValue == 0) changedFields |= (1 << x); // any change from zero is a change of more than threshold percent
+		else if ((delta / threshold) > (lastValue / 100)) changedFields |= (1 << x); // divide rather than multiply, to stay within 32 bits
+
+	}
+
+	return changedFields;
+
+}
+
+#endif // defined(useDataLogDelta)
+
+#if defined(useBinaryLogging)
+/* binary telemetry support section */
+
+static void binaryLog::outputRecord(interfaceDevice &dev, uint8_t streamIdx)
+{
+
+	union union_64 * tmpPtr2 = (union union_64 *)(&s64reg[s64reg2]);
+	uint8_t * buff = blBuffer[(uint16_t)(streamIdx)];
 
-	for (uint8_t x = 0; x < dLIcount; x++)
+	uint16_t tripCalc;
+	uint32_t value;
+	uint8_t fieldCount;
+	uint8_t divider;
+	uint8_t i;
+#if defined(useDataLogFieldList)
+	uint16_t signature;
+#endif // defined(useDataLogFieldList)
+
+	if (blFrameLength[(uint16_t)(streamIdx)]) return; // the previous frame is still going out, so skip this record rather than stall
+
+	fieldCount = dataLogGetFieldCount();
+
+	divider = 1; // JSON port records go out every sample
+#if defined(useDataLogFieldList)
+	if (streamIdx == blStreamLogging) divider = EEPROM::readByte(pDataLogDividerIdx);
+	if (divider == 0) divider = 1; // a divider of 0 also sends a record every sample
+
+	signature = _crc_ccitt_update(dataLogGetFieldSignature(fieldCount), divider);
+
+	if (signature != blFieldSignature[(uint16_t)(streamIdx)]) // if the field list or divider has changed, send a fresh schema right away
+	{
+
+		blFieldSignature[(uint16_t)(streamIdx)] = signature;
+		blSchemaCountdown[(uint16_t)(streamIdx)] = 0;
+
+	}
+
+#endif // defined(useDataLogFieldList)
+	if (blSchemaCountdown[(uint16_t)(streamIdx)] == 0)
+	{
+
+		blSchemaCountdown[(uint16_t)(streamIdx)] = blSchemaInterval;
+
+		i = startRecord(blRecordSchema, streamIdx);
+
+		buff[(uint16_t)(i++)] = blFormatVersion;
+		buff[(uint16_t)(i++)] = fieldCount;
+		buff[(uint16_t)(i++)] = ((metricFlag & metricMode) ? 1 : 0);
+		buff[(uint16_t)(i++)] = loopsPerSecond;
+		buff[(uint16_t)(i++)] = divider;
+
+		for (uint8_t x = 0; x < fieldCount; x++)
+		{
+
+			tripCalc = dataLogGetField(x);
+			translateCalcIdx(tripCalc, 0, 0); // fetch decimal places for this trip function
+
+			buff[(uint16_t)(i++)] = (uint8_t)(tripCalc >> 8);
+			buff[(uint16_t)(i++)] = (uint8_t)(tripCalc);
+			buff[(uint16_t)(i++)] = mainCalcFuncVar.decimalPlaces;
+
+		}
+
+	}
+	else
 	{
 
-		if ((x + 1) == dLIcount) c = '\n';
+		i = startRecord(blRecordData, streamIdx);
+
+		for (uint8_t x = 0; x < fieldCount; x++)
+		{
+
+			tripCalc = dataLogGetField(x);
+			SWEET64::doCalculate((uint8_t)(tripCalc >> 8), (uint8_t)(tripCalc));
+
+			if (tmpPtr2->ul[1]) value = 0xFFFFFFFF; // saturate anything that does not fit in 32 bits
+			else value = tmpPtr2->ul[0];
+
+			for (uint8_t y = 0; y < 4; y++)
+			{
 
-		// perform the required decimal formatting, and output the number
-		text::tripFunctionOut(devLogOutput, pgm_read_word(&dataLogTripCalcFormats[(uint16_t)(x)]), 0, (dfOverflow9s));
-		text::charOut(devLogOutput, c);
+				buff[(uint16_t)(i++)] = (uint8_t)(value);
+				value >>= 8;
+
+			}
+
+		}
 
 	}
 
+	blSchemaCountdown[(uint16_t)(streamIdx)]--;
+
+	encodeFrame(streamIdx, i);
+	outputStep(dev, streamIdx); // start sending the frame right away, and let the main loop send whatever does not fit yet
+
 }
 
+// the record starts one byte into the frame buffer, leaving room for the first COBS code byte
+static uint8_t binaryLog::startRecord(uint8_t recordType, uint8_t streamIdx)
+{
+
+	uint8_t * buff = blBuffer[(uint16_t)(streamIdx)];
+
+	buff[1] = recordType;
+	buff[2] = blSequence[(uint16_t)(streamIdx)]++;
+
+	return 3;
+
+}
+
+// appends the CRC, then COBS encodes the record in place and terminates the frame
+static void binaryLog::encodeFrame(uint8_t streamIdx, uint8_t length)
+{
+
+	uint8_t * buff = blBuffer[(uint16_t)(streamIdx)];
+
+	uint16_t crc;
+	uint8_t i;
+	uint8_t j;
+
+	crc = 0xFFFF;
+
+	for (i = 1; i < length; i++) crc = _crc_ccitt_update(crc, buff[(uint16_t)(i)]);
+
+	buff[(uint16_t)(length++)] = (uint8_t)(crc >> 8);
+	buff[(uint16_t)(length++)] = (uint8_t)(crc);
+
+	j = 0; // position of the code byte for the current run of non-zero bytes
+
+	for (i = 1; i < length; i++)
+		if (buff[(uint16_t)(i)] == 0) // each zero byte becomes the code byte for the run after it
+		{
+
+			buff[(uint16_t)(j)] = i - j; // distance from this code byte to the next (implied) zero byte
+			j = i;
+
+		}
+
+	buff[(uint16_t)(j)] = length - j;
+	buff[(uint16_t)(length++)] = 0; // end of frame
+
+	blFrameLength[(uint16_t)(streamIdx)] = length;
+	blFrameIdx[(uint16_t)(streamIdx)] = 0;
+
+}
+
+// sends as much of the frame in progress as the output buffer has room for, as raw bytes that bypass text control
+//    character processing
+static void binaryLog::outputStep(interfaceDevice &dev, uint8_t streamIdx)
+{
+
+	uint8_t * buff = blBuffer[(uint16_t)(streamIdx)];
+
+	while (blFrameIdx[(uint16_t)(streamIdx)] < blFrameLength[(uint16_t)(streamIdx)])
+	{
+
+#if defined(useBuffering)
+		if (text::freeSpace(dev) == 0) return; // wait for the output buffer to drain some more
+
+#endif // defined(useBuffering)
+		dev.chrOut(buff[(uint16_t)(blFrameIdx[(uint16_t)(streamIdx)]++)]);
+
+	}
+
+	blFrameLength[(uint16_t)(streamIdx)] = 0; // frame is complete
+
+}
+
+#endif // defined(useBinaryLogging)
 #endif // defined(useDataLoggingOutput)
 #if defined(useJSONoutput)
 /* JSON formatting support section */
@@ -210,6 +629,28 @@ static void doOutputJSONremainingFuel(void)
 }
 
 static void doOutputJSON(void) //skybolt added JSON output function
+{
+
+	if (JSONstep) return; // the previous payload is still going out, so skip this one rather than stall
+
+#if defined(useBinaryLogging)
+	if (EEPROM::readByte(pJSONoutputIdx) == 2)
+	{
+
+		binaryLog::outputRecord(devJSONoutput, blStreamJSON);
+		return;
+
+	}
+
+#endif // defined(useBinaryLogging)
+	JSONstep = 1; // the main loop will now output this payload one part at a time, via doOutputJSONstep()
+
+}
+
+// outputs the next part of the JSON payload in progress - each part is one key of one graph, so that the main loop
+//    never spends more than a few trip function evaluations' worth of time here before it gets back to buttons and display
+// a part is only started once the output buffer has some room, so a slow port simply stretches the payload out in time
+static void doOutputJSONstep(void)
 {
 
 	static uint8_t subtitleCount1 = 2;
@@ -220,242 +661,293 @@ static void doOutputJSON(void) //skybolt added JSON output function
 	uint32_t targetDistance;
 #endif // defined(useDragRaceFunction)
 
-	if (timer0Status & t0sOutputJSON) // replaced timerChecker with this because it's a more accurate method to change once every 1.6 seconds
+#if defined(useBuffering)
+	if (text::freeSpace(devJSONoutput) < outputRecordStartSpace) return; // wait for the output buffer to drain some more
+
+#endif // defined(useBuffering)
+	switch (JSONstep++)
 	{
 
-		heart::changeBitFlags(timer0Status, t0sOutputJSON, 0); // clear JSON subtitle change timer command
+		// first graph, fuel
+		case 1:
+			if (timer0Status & t0sOutputJSON) // replaced timerChecker with this because it's a more accurate method to change once every 1.6 seconds
+			{
+
+				heart::changeBitFlags(timer0Status, t0sOutputJSON, 0); // clear JSON subtitle change timer command
 
-		if (!(--subtitleCount1)) subtitleCount1 = 2;
+				if (!(--subtitleCount1)) subtitleCount1 = 2;
 #if defined(useDragRaceFunction)
-		if (!(--subtitleCount2)) subtitleCount2 = 3;
+				if (!(--subtitleCount2)) subtitleCount2 = 3;
 #endif // defined(useDragRaceFunction)
 
-	}
-
-	JSONsupport::init(devJSONoutput); // begin JSON payload
-
-	JSONsupport::openElement(devJSONoutput, JSONflagArray);
+			}
 
-	// first graph, fuel
+			JSONsupport::init(devJSONoutput); // begin JSON payload
 
-	JSONsupport::openElement(devJSONoutput, JSONflagObject);
+			JSONsupport::openElement(devJSONoutput, JSONflagArray);
 
-	JSONsupport::openKey(devJSONoutput, JSONtitleStr, JSONflagString);
-	doOutputJSONremainingFuel();
+			JSONsupport::openElement(devJSONoutput, JSONflagObject);
 
-	// text::tripFunctionOut(devJSONoutput, instantIdx, tEngineSpeed, 0, (dfOverflow9s | dfOutputLabel)); // rpm to test latency only vs tachometer and LCD vs raspi indicator (expect 2x looptime)
+#if defined(useLogRecordStamps)
+			JSONsupport::openKey(devJSONoutput, JSONsequenceStr, 0);
+			JSONsupport::outputElementNext(devJSONoutput, 0);
+			logStamp::numberOut(devJSONoutput, JSONsequence++);
 
-	JSONsupport::openKey(devJSONoutput, JSONsubtitleStr, JSONflagString);
-	switch (subtitleCount1)
-	{
+			JSONsupport::openKey(devJSONoutput, JSONmillisecondsStr, 0);
+			JSONsupport::outputElementNext(devJSONoutput, 0);
+			logStamp::numberOut(devJSONoutput, logStamp::milliseconds());
 
-		case 2:
-			text::stringOut(devJSONoutput, PSTR("fuel used: "));
-			text::stringOut(devJSONoutput, tripStr);
-			text::tripFunctionOut(devJSONoutput, currentIdx, tFuelUsed, 0, (dfOverflow9s | dfOutputLabel)); // current trip fuel used
-			text::stringOut(devJSONoutput, semicolonTankStr);
-			text::tripFunctionOut(devJSONoutput, tankIdx, tFuelUsed, 0, (dfOverflow9s | dfOutputLabel)); // tank trip fuel used
-			text::stringOut(devJSONoutput, semicolonUsingStr);
-			text::tripFunctionOut(devJSONoutput, instantIdx, tFuelRate, 0, (dfOverflow9s | dfOutputLabel)); // current rate of fuel burn in units/time
+#endif // defined(useLogRecordStamps)
+			JSONsupport::openKey(devJSONoutput, JSONtitleStr, JSONflagString);
+			doOutputJSONremainingFuel();
 
+			// text::tripFunctionOut(devJSONoutput, instantIdx, tEngineSpeed, 0, (dfOverflow9s | dfOutputLabel)); // rpm to test latency only vs tachometer and LCD vs raspi indicator (expect 2x looptime)
 			break;
 
-		case 1:
-			text::stringOut(devJSONoutput, PSTR("eco stats: "));
+		case 2:
+			JSONsupport::openKey(devJSONoutput, JSONsubtitleStr, JSONflagString);
+			switch (subtitleCount1)
+			{
+
+				case 2:
+					text::stringOut(devJSONoutput, PSTR("fuel used: "));
+					text::stringOut(devJSONoutput, tripStr);
+					text::tripFunctionOut(devJSONoutput, currentIdx, tFuelUsed, 0, (dfOverflow9s | dfOutputLabel)); // current trip fuel used
+					text::stringOut(devJSONoutput, semicolonTankStr);
+					text::tripFunctionOut(devJSONoutput, tankIdx, tFuelUsed, 0, (dfOverflow9s | dfOutputLabel)); // tank trip fuel used
+					text::stringOut(devJSONoutput, semicolonUsingStr);
+					text::tripFunctionOut(devJSONoutput, instantIdx, tFuelRate, 0, (dfOverflow9s | dfOutputLabel)); // current rate of fuel burn in units/time
+
+					break;
+
+				case 1:
+					text::stringOut(devJSONoutput, PSTR("eco stats: "));
 #if defined(trackIdleEOCdata)
-			text::stringOut(devJSONoutput, PSTR("used@idle "));
-			text::tripFunctionOut(devJSONoutput, eocIdleTankIdx, tFuelUsed, 0, (dfOverflow9s | dfOutputLabel));
-			text::stringOut(devJSONoutput, PSTR(", fuel cut "));
-			text::tripFunctionOut(devJSONoutput, eocIdleTankIdx, tDistance, 0, (dfOverflow9s | dfOutputLabel));
+					text::stringOut(devJSONoutput, PSTR("used@idle "));
+					text::tripFunctionOut(devJSONoutput, eocIdleTankIdx, tFuelUsed, 0, (dfOverflow9s | dfOutputLabel));
+					text::stringOut(devJSONoutput, PSTR(", fuel cut "));
+					text::tripFunctionOut(devJSONoutput, eocIdleTankIdx, tDistance, 0, (dfOverflow9s | dfOutputLabel));
 #else // defined(trackIdleEOCdata)
-			doOutputJSONremainingFuel();
+					doOutputJSONremainingFuel();
 #endif // defined(trackIdleEOCdata)
 
-			break;
-
-	}
+					break;
 
-	//ranges do not have to be in order, d3js libraries will auto sort, so you can make it easier to read the code by changing the order
-	JSONsupport::openKey(devJSONoutput, JSONrangesStr, JSONflagArray);
-	JSONsupport::outputNumber(devJSONoutput, tankIdx, tFuelQuantity); // largest, full tank size (e.g, 13.8 g)
-	JSONsupport::outputNumber(devJSONoutput, tankIdx, tReserveQuantity); // full tank less reserve (e.g.13.8g - 2.2g = 11.6g)
-	JSONsupport::outputNumber(devJSONoutput, tankIdx, tBingoQuantity); // reserve amount (e.g. 2.2g)
+			}
+			break;
 
-	JSONsupport::openKey(devJSONoutput, JSONmeasuresStr, JSONflagArray);
-	JSONsupport::outputNumber(devJSONoutput, tankIdx, tReserveRemainingFuel); // reserve remaining fuel left
-	JSONsupport::outputNumber(devJSONoutput, tankIdx, tRemainingFuel); // total remaining fuel left
+		case 3:
+			//ranges do not have to be in order, d3js libraries will auto sort, so you can make it easier to read the code by changing the order
+			JSONsupport::openKey(devJSONoutput, JSONrangesStr, JSONflagArray);
+			JSONsupport::outputNumber(devJSONoutput, tankIdx, tFuelQuantity); // largest, full tank size (e.g, 13.8 g)
+			JSONsupport::outputNumber(devJSONoutput, tankIdx, tReserveQuantity); // full tank less reserve (e.g.13.8g - 2.2g = 11.6g)
+			JSONsupport::outputNumber(devJSONoutput, tankIdx, tBingoQuantity); // reserve amount (e.g. 2.2g)
+			break;
 
-	JSONsupport::openKey(devJSONoutput, JSONmarkersStr, JSONflagArray);
-	JSONsupport::outputNumber(devJSONoutput, instantIdx, tFuelRate); // current rate of fuel burn in units/time
+		case 4:
+			JSONsupport::openKey(devJSONoutput, JSONmeasuresStr, JSONflagArray);
+			JSONsupport::outputNumber(devJSONoutput, tankIdx, tReserveRemainingFuel); // reserve remaining fuel left
+			JSONsupport::outputNumber(devJSONoutput, tankIdx, tRemainingFuel); // total remaining fuel left
+			break;
 
-	JSONsupport::closeElement(devJSONoutput);
+		case 5:
+			JSONsupport::openKey(devJSONoutput, JSONmarkersStr, JSONflagArray);
+			JSONsupport::outputNumber(devJSONoutput, instantIdx, tFuelRate); // current rate of fuel burn in units/time
 
-	// second graph, distance
-	JSONsupport::openElement(devJSONoutput, JSONflagObject);
+			JSONsupport::closeElement(devJSONoutput);
+			break;
 
-	JSONsupport::openKey(devJSONoutput, JSONtitleStr, JSONflagString);
-	text::tripFunctionOut(devJSONoutput, tankIdx, tReserveDistanceToEmpty, 0, (dfOverflow9s | dfOutputLabel)); // distance to bingo
-	text::stringOut(devJSONoutput, PSTR(" to e, "));
-	text::tripFunctionOut(devJSONoutput, tankIdx, tBingoDistanceToEmpty, 0, (dfOverflow9s | dfOutputLabel)); // distance to fully empty tank from bingo
-	text::stringOut(devJSONoutput, PSTR(" e-reserve"));
+		// second graph, distance
+		case 6:
+			JSONsupport::openElement(devJSONoutput, JSONflagObject);
 
-	JSONsupport::openKey(devJSONoutput, JSONsubtitleStr, JSONflagString);
-	switch (subtitleCount1)
-	{
-
-		case 2:
-			//	text::stringOut(devJSONoutput, PSTR("trip/tank distance: "));
-			//	text::tripFunctionOut(devJSONoutput, currentIdx, tDistance, 0, (dfOverflow9s | dfOutputLabel)); // current trip distance
-			//	text::stringOut(devJSONoutput, PSTR("/"));
-			//	text::tripFunctionOut(devJSONoutput, tankIdx, tDistance, 0, (dfOverflow9s | dfOutputLabel)); // current trip distance
-
-			text::tripFunctionOut(devJSONoutput, currentIdx, tDistance, 0, (dfOverflow9s | dfOutputLabel)); // current trip distance
-			text::stringOut(devJSONoutput, PSTR(" trip distance, "));
-			text::tripFunctionOut(devJSONoutput, tankIdx, tDistance, 0, (dfOverflow9s | dfOutputLabel)); // current trip distance
-			text::stringOut(devJSONoutput, PSTR(" tank distance"));
+			JSONsupport::openKey(devJSONoutput, JSONtitleStr, JSONflagString);
+			text::tripFunctionOut(devJSONoutput, tankIdx, tReserveDistanceToEmpty, 0, (dfOverflow9s | dfOutputLabel)); // distance to bingo
+			text::stringOut(devJSONoutput, PSTR(" to e, "));
+			text::tripFunctionOut(devJSONoutput, tankIdx, tBingoDistanceToEmpty, 0, (dfOverflow9s | dfOutputLabel)); // distance to fully empty tank from bingo
+			text::stringOut(devJSONoutput, PSTR(" e-reserve"));
 			break;
 
-		case 1:
-			text::tripFunctionOut(devJSONoutput, tankIdx, tReserveDistance, 0, (dfOverflow9s | dfOutputLabel)); // reserve range
-			text::stringOut(devJSONoutput, PSTR(" safe range, "));
-			text::tripFunctionOut(devJSONoutput, tankIdx, tRangeDistance, 0, (dfOverflow9s | dfOutputLabel)); // distance to fully empty tank
-			text::stringOut(devJSONoutput, PSTR(" dry range"));
+		case 7:
+			JSONsupport::openKey(devJSONoutput, JSONsubtitleStr, JSONflagString);
+			switch (subtitleCount1)
+			{
+
+				case 2:
+					//	text::stringOut(devJSONoutput, PSTR("trip/tank distance: "));
+					//	text::tripFunctionOut(devJSONoutput, currentIdx, tDistance, 0, (dfOverflow9s | dfOutputLabel)); // current trip distance
+					//	text::stringOut(devJSONoutput, PSTR("/"));
+					//	text::tripFunctionOut(devJSONoutput, tankIdx, tDistance, 0, (dfOverflow9s | dfOutputLabel)); // current trip distance
+
+					text::tripFunctionOut(devJSONoutput, currentIdx, tDistance, 0, (dfOverflow9s | dfOutputLabel)); // current trip distance
+					text::stringOut(devJSONoutput, PSTR(" trip distance, "));
+					text::tripFunctionOut(devJSONoutput, tankIdx, tDistance, 0, (dfOverflow9s | dfOutputLabel)); // current trip distance
+					text::stringOut(devJSONoutput, PSTR(" tank distance"));
+					break;
+
+				case 1:
+					text::tripFunctionOut(devJSONoutput, tankIdx, tReserveDistance, 0, (dfOverflow9s | dfOutputLabel)); // reserve range
+					text::stringOut(devJSONoutput, PSTR(" safe range, "));
+					text::tripFunctionOut(devJSONoutput, tankIdx, tRangeDistance, 0, (dfOverflow9s | dfOutputLabel)); // distance to fully empty tank
+					text::stringOut(devJSONoutput, PSTR(" dry range"));
+					break;
+
+			}
 			break;
 
-	}
-
-	JSONsupport::openKey(devJSONoutput, JSONrangesStr, JSONflagArray);
-	JSONsupport::outputNumber(devJSONoutput, tankIdx, tRangeDistance); // maximum range
-	JSONsupport::outputNumber(devJSONoutput, tankIdx, tReserveDistance); // range 2, safe range
-	JSONsupport::outputNumber(devJSONoutput, prgmFindHalfReserveRange, tankIdx, 1); // range 3, half of safe range
-
-	JSONsupport::openKey(devJSONoutput, JSONmeasuresStr, JSONflagArray);
-	JSONsupport::outputNumber(devJSONoutput, tankIdx, tBingoDistance); // shows miles of e-reserve in bar form
+		case 8:
+			JSONsupport::openKey(devJSONoutput, JSONrangesStr, JSONflagArray);
+			JSONsupport::outputNumber(devJSONoutput, tankIdx, tRangeDistance); // maximum range
+			JSONsupport::outputNumber(devJSONoutput, tankIdx, tReserveDistance); // range 2, safe range
+			JSONsupport::outputNumber(devJSONoutput, prgmFindHalfReserveRange, tankIdx, 1); // range 3, half of safe range
+			break;
 
-	JSONsupport::openKey(devJSONoutput, JSONmarkersStr, JSONflagArray);
-	JSONsupport::outputNumber(devJSONoutput, tankIdx, tDistanceToEmpty); // line is distance to empty
+		case 9:
+			JSONsupport::openKey(devJSONoutput, JSONmeasuresStr, JSONflagArray);
+			JSONsupport::outputNumber(devJSONoutput, tankIdx, tBingoDistance); // shows miles of e-reserve in bar form
+			break;
 
-	JSONsupport::closeElement(devJSONoutput);
+		case 10:
+			JSONsupport::openKey(devJSONoutput, JSONmarkersStr, JSONflagArray);
+			JSONsupport::outputNumber(devJSONoutput, tankIdx, tDistanceToEmpty); // line is distance to empty
 
-	// third graph, econ
+			JSONsupport::closeElement(devJSONoutput);
+			break;
 
-	JSONsupport::openElement(devJSONoutput, JSONflagObject);
+		// third graph, econ
+		case 11:
+			JSONsupport::openElement(devJSONoutput, JSONflagObject);
 
-	JSONsupport::openKey(devJSONoutput, JSONtitleStr, JSONflagString);
+			JSONsupport::openKey(devJSONoutput, JSONtitleStr, JSONflagString);
 #if defined(useDragRaceFunction)
 
-	if (accelTestState) //display if we have encountered a state change in the drag test
-	{
+			if (accelTestState) //display if we have encountered a state change in the drag test
+			{
 
-		text::stringOut(devJSONoutput, findStr(JSONaccelTestStateMsgs, accelTestState));
-		text::stringOut(devJSONoutput, PSTR(" ..."));
+				text::stringOut(devJSONoutput, findStr(JSONaccelTestStateMsgs, accelTestState));
+				text::stringOut(devJSONoutput, PSTR(" ..."));
 
-	}
-	else // else not racing or waiting, go to normal
-	{
+			}
+			else // else not racing or waiting, go to normal
+			{
 
-		doOutputJSONfuelEcon(PSTR("fuel economy trip/tank/inst: "), currentIdx); // gal or L, then current fuel economy
-		doOutputJSONfuelEcon(PSTR("/ "), tankIdx); // tank fuel economy
-		doOutputJSONfuelEcon(PSTR("/ "), instantIdx); // instantaneous fuel economy
+				doOutputJSONfuelEcon(PSTR("fuel economy trip/tank/inst: "), currentIdx); // gal or L, then current fuel economy
+				doOutputJSONfuelEcon(PSTR("/ "), tankIdx); // tank fuel economy
+				doOutputJSONfuelEcon(PSTR("/ "), instantIdx); // instantaneous fuel economy
 
-	}
+			}
 #else // defined(useDragRaceFunction)
-	doOutputJSONfuelEcon(PSTR("fuel economy trip/tank/inst: "), currentIdx); // gal or L, then current fuel economy
-	doOutputJSONfuelEcon(PSTR("/ "), tankIdx); // tank fuel economy
-	doOutputJSONfuelEcon(PSTR("/ "), instantIdx); // instantaneous fuel economy
+			doOutputJSONfuelEcon(PSTR("fuel economy trip/tank/inst: "), currentIdx); // gal or L, then current fuel economy
+			doOutputJSONfuelEcon(PSTR("/ "), tankIdx); // tank fuel economy
+			doOutputJSONfuelEcon(PSTR("/ "), instantIdx); // instantaneous fuel economy
 #endif // defined(useDragRaceFunction)
+			break;
 
-	JSONsupport::openKey(devJSONoutput, JSONsubtitleStr, JSONflagString);
+		case 12:
+			JSONsupport::openKey(devJSONoutput, JSONsubtitleStr, JSONflagString);
 #if defined(useDragRaceFunction)
-	targetSpeed = SWEET64::runPrgm(prgmFetchParameterValue, pDragSpeedIdx); // accel test speed
-	targetDistance = SWEET64::runPrgm(prgmFetchParameterValue, pDragDistanceIdx); // accel test distance
+			targetSpeed = SWEET64::runPrgm(prgmFetchParameterValue, pDragSpeedIdx); // accel test speed
+			targetDistance = SWEET64::runPrgm(prgmFetchParameterValue, pDragDistanceIdx); // accel test distance
 
-	switch (subtitleCount2)
-	{
+			switch (subtitleCount2)
+			{
 
-		case 3:
-			//1 & 2 seconds display
-			text::stringOut(devJSONoutput, PSTR("accel time: 0-"));
-
-			doOutputJSONnumber(targetSpeed / 2, 0, PSTR("/"));
-			doOutputJSONnumber(targetSpeed, 0, PSTR(": "));
-
-			text::tripFunctionOut(devJSONoutput, dragHalfSpeedIdx, tAccelTestTime, 0, dfOverflow9s); // 0-(half speed) time
-			text::stringOut(devJSONoutput, PSTR("/"));
-			text::tripFunctionOut(devJSONoutput, dragFullSpeedIdx, tAccelTestTime, 0, dfOverflow9s); // 0-(full speed) time
-			text::stringOut(devJSONoutput, PSTR(", "));
-			text::tripFunctionOut(devJSONoutput, dragDistanceIdx, tDistance, 0, (dfOverflow9s | dfOutputLabel)); // trap distance
-			text::stringOut(devJSONoutput, PSTR(" in "));
-			text::tripFunctionOut(devJSONoutput, dragDistanceIdx, tAccelTestTime, 0, (dfOverflow9s | dfOutputLabel)); // trap time
-			text::stringOut(devJSONoutput, PSTR(" @"));
-			text::tripFunctionOut(devJSONoutput, dragDistanceIdx, tTrapSpeed, 0, (dfOverflow9s | dfOutputLabel)); // trap speed
-			text::stringOut(devJSONoutput, PSTR("; "));
-			text::tripFunctionOut(devJSONoutput, dragDistanceIdx, tEstimatedEnginePower, 0, (dfOverflow9s | dfOutputLabel)); // estimated engine power
-			text::stringOut(devJSONoutput, PSTR(" @"));
-			text::tripFunctionOut(devJSONoutput, dragDistanceIdx, tDragSpeed, 0, (dfOverflow9s | dfOutputLabel)); // max speed
-			break;
+				case 3:
+					//1 & 2 seconds display
+					text::stringOut(devJSONoutput, PSTR("accel time: 0-"));
 
-		case 2:
-			text::stringOut(devJSONoutput, PSTR("accel fuel: "));
-			text::tripFunctionOut(devJSONoutput, dragHalfSpeedIdx, tFuelUsed, 0, (dfOverflow9s | dfOutputLabel)); // 0-(half speed) fuel
-			text::stringOut(devJSONoutput, PSTR(" to "));
+					doOutputJSONnumber(targetSpeed / 2, 0, PSTR("/"));
+					doOutputJSONnumber(targetSpeed, 0, PSTR(": "));
 
-			doOutputJSONnumber(targetSpeed / 2, 0, PSTR(" " tcOMOFF "MPH" tcOTOG "KPH" tcOON ", ")); // 0-(half speed)
+					text::tripFunctionOut(devJSONoutput, dragHalfSpeedIdx, tAccelTestTime, 0, dfOverflow9s); // 0-(half speed) time
+					text::stringOut(devJSONoutput, PSTR("/"));
+					text::tripFunctionOut(devJSONoutput, dragFullSpeedIdx, tAccelTestTime, 0, dfOverflow9s); // 0-(full speed) time
+					text::stringOut(devJSONoutput, PSTR(", "));
+					text::tripFunctionOut(devJSONoutput, dragDistanceIdx, tDistance, 0, (dfOverflow9s | dfOutputLabel)); // trap distance
+					text::stringOut(devJSONoutput, PSTR(" in "));
+					text::tripFunctionOut(devJSONoutput, dragDistanceIdx, tAccelTestTime, 0, (dfOverflow9s | dfOutputLabel)); // trap time
+					text::stringOut(devJSONoutput, PSTR(" @"));
+					text::tripFunctionOut(devJSONoutput, dragDistanceIdx, tTrapSpeed, 0, (dfOverflow9s | dfOutputLabel)); // trap speed
+					text::stringOut(devJSONoutput, PSTR("; "));
+					text::tripFunctionOut(devJSONoutput, dragDistanceIdx, tEstimatedEnginePower, 0, (dfOverflow9s | dfOutputLabel)); // estimated engine power
+					text::stringOut(devJSONoutput, PSTR(" @"));
+					text::tripFunctionOut(devJSONoutput, dragDistanceIdx, tDragSpeed, 0, (dfOverflow9s | dfOutputLabel)); // max speed
+					break;
 
-			text::tripFunctionOut(devJSONoutput, dragFullSpeedIdx, tFuelUsed, 0, (dfOverflow9s | dfOutputLabel)); // 0-(full speed) fuel
-			text::stringOut(devJSONoutput, PSTR(" to "));
+				case 2:
+					text::stringOut(devJSONoutput, PSTR("accel fuel: "));
+					text::tripFunctionOut(devJSONoutput, dragHalfSpeedIdx, tFuelUsed, 0, (dfOverflow9s | dfOutputLabel)); // 0-(half speed) fuel
+					text::stringOut(devJSONoutput, PSTR(" to "));
 
-			doOutputJSONnumber(targetSpeed, 0, PSTR(" " tcOMOFF "MPH" tcOTOG "KPH" tcOON ", ")); // 0-(full speed)
+					doOutputJSONnumber(targetSpeed / 2, 0, PSTR(" " tcOMOFF "MPH" tcOTOG "KPH" tcOON ", ")); // 0-(half speed)
 
-			text::tripFunctionOut(devJSONoutput, dragDistanceIdx, tFuelUsed, 0, (dfOverflow9s | dfOutputLabel)); // trap fuel
-			text::stringOut(devJSONoutput, PSTR(" to "));
+					text::tripFunctionOut(devJSONoutput, dragFullSpeedIdx, tFuelUsed, 0, (dfOverflow9s | dfOutputLabel)); // 0-(full speed) fuel
+					text::stringOut(devJSONoutput, PSTR(" to "));
 
-			doOutputJSONnumber(targetDistance, 2, PSTR(" " tcOMOFF "mi" tcOTOG "km" tcOON ", ")); // to [trap distance]
+					doOutputJSONnumber(targetSpeed, 0, PSTR(" " tcOMOFF "MPH" tcOTOG "KPH" tcOON ", ")); // 0-(full speed)
 
-			break;
+					text::tripFunctionOut(devJSONoutput, dragDistanceIdx, tFuelUsed, 0, (dfOverflow9s | dfOutputLabel)); // trap fuel
+					text::stringOut(devJSONoutput, PSTR(" to "));
 
-		case 1:
-			text::stringOut(devJSONoutput, PSTR("accel fuel: "));
+					doOutputJSONnumber(targetDistance, 2, PSTR(" " tcOMOFF "mi" tcOTOG "km" tcOON ", ")); // to [trap distance]
 
-			text::tripFunctionOut(devJSONoutput, dragHalfSpeedIdx, tFuelEcon, 0, (dfOverflow9s | dfOutputLabel)); // 0-(half speed) mpg
-			text::stringOut(devJSONoutput, PSTR(" to "));
+					break;
 
-			doOutputJSONnumber(targetSpeed / 2, 0, PSTR(" " tcOMOFF "MPH" tcOTOG "KPH" tcOON ", ")); // 0-(half speed)
+				case 1:
+					text::stringOut(devJSONoutput, PSTR("accel fuel: "));
 
-			text::tripFunctionOut(devJSONoutput, dragFullSpeedIdx, tFuelEcon, 0, (dfOverflow9s | dfOutputLabel)); // 0-(full speed) mpg
-			text::stringOut(devJSONoutput, PSTR(" to "));
+					text::tripFunctionOut(devJSONoutput, dragHalfSpeedIdx, tFuelEcon, 0, (dfOverflow9s | dfOutputLabel)); // 0-(half speed) mpg
+					text::stringOut(devJSONoutput, PSTR(" to "));
 
-			doOutputJSONnumber(targetSpeed, 0, PSTR(" " tcOMOFF "MPH" tcOTOG "KPH" tcOON ", ")); // 0-(full speed)
+					doOutputJSONnumber(targetSpeed / 2, 0, PSTR(" " tcOMOFF "MPH" tcOTOG "KPH" tcOON ", ")); // 0-(half speed)
 
-			text::tripFunctionOut(devJSONoutput, dragDistanceIdx, tFuelEcon, 0, (dfOverflow9s | dfOutputLabel)); // trap mpg
-			text::stringOut(devJSONoutput, PSTR(" to "));
+					text::tripFunctionOut(devJSONoutput, dragFullSpeedIdx, tFuelEcon, 0, (dfOverflow9s | dfOutputLabel)); // 0-(full speed) mpg
+					text::stringOut(devJSONoutput, PSTR(" to "));
 
-			doOutputJSONnumber(targetDistance, 2, PSTR(" " tcOMOFF "mi" tcOTOG "km" tcOON ", ")); // to [trap distance]
+					doOutputJSONnumber(targetSpeed, 0, PSTR(" " tcOMOFF "MPH" tcOTOG "KPH" tcOON ", ")); // 0-(full speed)
 
-			break;
+					text::tripFunctionOut(devJSONoutput, dragDistanceIdx, tFuelEcon, 0, (dfOverflow9s | dfOutputLabel)); // trap mpg
+					text::stringOut(devJSONoutput, PSTR(" to "));
 
-	}
+					doOutputJSONnumber(targetDistance, 2, PSTR(" " tcOMOFF "mi" tcOTOG "km" tcOON ", ")); // to [trap distance]
+
+					break;
+
+			}
 #else // defined(useDragRaceFunction)
-	text::stringOut(devJSONoutput, PSTR("[this space intentionally left blank]"));
+			text::stringOut(devJSONoutput, PSTR("[this space intentionally left blank]"));
 #endif // defined(useDragRaceFunction)
+			break;
+
+		case 13:
+			JSONsupport::openKey(devJSONoutput, JSONrangesStr, JSONflagArray);
+			// set scale at 40mpg or instant econ up to 999 mpg. Folks like to watch their mpg meter go to extremes
+			JSONsupport::outputNumber(devJSONoutput, 18000ul, 3);
+			JSONsupport::outputNumber(devJSONoutput, 24000ul, 3);
+			JSONsupport::outputNumber(devJSONoutput, min(max(40000, SWEET64::doCalculate(instantIdx, tFuelEcon)), 999000), 3);
+			break;
 
-	JSONsupport::openKey(devJSONoutput, JSONrangesStr, JSONflagArray);
-	// set scale at 40mpg or instant econ up to 999 mpg. Folks like to watch their mpg meter go to extremes
-	JSONsupport::outputNumber(devJSONoutput, 18000ul, 3);
-	JSONsupport::outputNumber(devJSONoutput, 24000ul, 3);
-	JSONsupport::outputNumber(devJSONoutput, min(max(40000, SWEET64::doCalculate(instantIdx, tFuelEcon)), 999000), 3);
+		case 14:
+			JSONsupport::openKey(devJSONoutput, JSONmeasuresStr, JSONflagArray);
+			JSONsupport::outputNumber(devJSONoutput, currentIdx, tFuelEcon); // current fuel economy
+			JSONsupport::outputNumber(devJSONoutput, tankIdx, tFuelEcon); // tank fuel economy
+			break;
 
-	JSONsupport::openKey(devJSONoutput, JSONmeasuresStr, JSONflagArray);
-	JSONsupport::outputNumber(devJSONoutput, currentIdx, tFuelEcon); // current fuel economy
-	JSONsupport::outputNumber(devJSONoutput, tankIdx, tFuelEcon); // tank fuel economy
+		case 15:
+			JSONsupport::openKey(devJSONoutput, JSONmarkersStr, JSONflagArray);
+			// instantaneous fuel economy, do not let scale exceed 999
+			JSONsupport::outputNumber(devJSONoutput, min(999000, SWEET64::doCalculate(instantIdx, tFuelEcon)), 3);
 
-	JSONsupport::openKey(devJSONoutput, JSONmarkersStr, JSONflagArray);
-	// instantaneous fuel economy, do not let scale exceed 999
-	JSONsupport::outputNumber(devJSONoutput, min(999000, SWEET64::doCalculate(instantIdx, tFuelEcon)), 3);
+			JSONsupport::closeElement(devJSONoutput);
 
-	JSONsupport::closeElement(devJSONoutput);
+			JSONsupport::closeElement(devJSONoutput); // end JSON payload, and go trigger read on python.script
 
-	JSONsupport::closeElement(devJSONoutput); // end JSON payload, and go trigger read on python.script
+			// fall through
+		default: // payload is complete
+			JSONstep = 0;
+			break;
+
+	}
 
 } // end sendJSON function
 
@@ -221,6 +221,12 @@ namespace terminal /* debug terminal section prototype */
 	static void outputDecimalValue(uint8_t lineNumber);
 	static void outputDecimalExtra(uint8_t lineNumber);
 	static void processMath(uint8_t cmd);
+	static void outputDeviceList(uint8_t cmd);
+	static void outputDeviceStatus(interfaceDevice &dev, const char * devName, uint8_t lcdFlag, uint8_t cmd);
+#if defined(useDebugCPUreading)
+	static void outputLatency(void);
+	static void outputMicroseconds(const char * labelStr, uint32_t t0Cycles);
+#endif // defined(useDebugCPUreading)
 
 }
 
@@ -285,11 +291,28 @@ static const char terminalHelp[] PROGMEM = {
 #endif // defined(useLegacyButtons)
 #endif // defined(useDebugButtonInjection)
 	"           S - toggles display status line echo to terminal" tcEOSCR
+	"           B - measures text output speed for each output device, in bytes per second" tcEOSCR
+	"           Q - lists free space and dropped byte count for each buffered output device" tcEOSCR
+#if defined(useDebugCPUreading)
+	"           J - lists worst-case timer0 overflow entry jitter and fuel injector close handler time since the last J, in us" tcEOSCR
+#endif // defined(useDebugCPUreading)
+#if defined(useParameterTransfer)
+	"           G - outputs all stored parameters as one checksummed {frame}" tcEOSCR
+	"           W - reads in a checksummed {frame}, and stores all parameters from it" tcEOSCR
+#endif // defined(useParameterTransfer)
 	"           ? - displays this help" tcEOSCR
 	tcEOS
 };
 
 #endif // defined(useDebugTerminalHelp)
+// two strings that differ at every position, so a shadow frame buffer cannot skip any of them
+static const char terminalBenchmarkStr[] PROGMEM = {
+	"0123456789ABCDEF" tcEOS
+	"FEDCBA9876543210" tcEOS
+};
+
+static const uint8_t terminalBenchmarkCount = 16; // number of benchmark strings to output, at 16 bytes each
+
 static uint8_t terminalState;
 static uint8_t nextTerminalState;
 static uint8_t terminalCmd;
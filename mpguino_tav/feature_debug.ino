@@ -27,6 +27,9 @@ static void systemInfo::idleProcess(void)
 			cli(); // disable interrupts to make the next operations atomic
 
 			volatileVariables[(uint16_t)(vInterruptAccumulatorIdx)] = 0;
+#if defined(use4BitLCD)
+			volatileVariables[(uint16_t)(vLCDdataNybbleCountIdx)] = 0;
+#endif // defined(use4BitLCD)
 
 			SREG = oldSREG; // restore interrupt flag status
 
@@ -44,6 +47,9 @@ static void systemInfo::idleProcess(void)
 			cli(); // disable interrupts to make the next operations atomic
 
 			mainProgramVariables[(uint16_t)(mpDebugAccInterruptIdx)] = volatileVariables[(uint16_t)(vInterruptAccumulatorIdx)];
+#if defined(use4BitLCD)
+			mainProgramVariables[(uint16_t)(mpDebugCountLCDnybbleIdx)] = volatileVariables[(uint16_t)(vLCDdataNybbleCountIdx)];
+#endif // defined(use4BitLCD)
 
 			SREG = oldSREG; // restore interrupt flag status
 
@@ -605,6 +611,107 @@ static void terminal::processMath(uint8_t cmd)
 
 }
 
+static void terminal::outputDeviceList(uint8_t cmd)
+{
+
+#if defined(useLCDoutput)
+	outputDeviceStatus(devLCD, PSTR("LCD" tcEOS), 1, cmd);
+#endif // defined(useLCDoutput)
+	outputDeviceStatus(devDebugTerminal, PSTR("Debug terminal" tcEOS), 0, cmd);
+#if defined(useDataLoggingOutput)
+	outputDeviceStatus(devLogOutput, PSTR("Data logging" tcEOS), 0, cmd);
+#endif // defined(useDataLoggingOutput)
+#if defined(useJSONoutput)
+	outputDeviceStatus(devJSONoutput, PSTR("JSON" tcEOS), 0, cmd);
+#endif // defined(useJSONoutput)
+#if defined(useBluetooth)
+	outputDeviceStatus(devBluetooth, PSTR("Bluetooth" tcEOS), 0, cmd);
+#endif // defined(useBluetooth)
+
+}
+
+static void terminal::outputDeviceStatus(interfaceDevice &dev, const char * devName, uint8_t lcdFlag, uint8_t cmd)
+{
+
+	uint32_t cycleLength;
+
+	if (cmd == 'B') // benchmark text output on this device
+	{
+
+		cycleLength = heart::cycles0();
+
+		for (uint8_t x = 0; x < terminalBenchmarkCount; x++)
+		{
+
+			if (lcdFlag) text::gotoXY(dev, 0, 0);
+			text::stringOut(dev, terminalBenchmarkStr, x & 1);
+
+		}
+
+		cycleLength = heart::findCycle0Length(cycleLength);
+		if (cycleLength == 0) cycleLength++;
+
+		if (lcdFlag == 0) text::newLine(dev);
+
+		text::stringOut(devDebugTerminal, devName);
+		text::stringOut(devDebugTerminal, PSTR(" bytes per second = " tcEOS));
+		text::hexDWordOut(devDebugTerminal, (uint32_t)(terminalBenchmarkCount) * 16ul * t0CyclesPerSecond / cycleLength);
+		text::newLine(devDebugTerminal);
+
+	}
+#if defined(useBuffering)
+	else if (dev.outputBuffer) // list output buffer status for this device
+	{
+
+		text::stringOut(devDebugTerminal, devName);
+		text::stringOut(devDebugTerminal, PSTR(" buffer free = " tcEOS));
+		text::hexWordOut(devDebugTerminal, text::freeSpace(dev));
+		text::stringOut(devDebugTerminal, PSTR(", dropped = " tcEOS));
+		text::hexWordOut(devDebugTerminal, dev.outputBuffer->dropCount);
+		text::stringOut(devDebugTerminal, PSTR(", policy = " tcEOS));
+		text::hexNybbleOut(devDebugTerminal, dev.outputBuffer->status & bufferPolicyMask);
+		text::newLine(devDebugTerminal);
+
+	}
+#endif // defined(useBuffering)
+
+}
+
+#if defined(useDebugCPUreading)
+static void terminal::outputLatency(void)
+{
+
+	uint8_t oldSREG;
+
+	oldSREG = SREG; // save interrupt flag status
+	cli(); // disable interrupts to make the next operations atomic
+
+	mainProgramVariables[(uint16_t)(mpDebugInterruptLatencyMaxIdx)] = volatileVariables[(uint16_t)(vInterruptLatencyMaxIdx)];
+	mainProgramVariables[(uint16_t)(mpDebugInjectorCloseMaxIdx)] = volatileVariables[(uint16_t)(vInjectorCloseMaxLengthIdx)];
+
+	volatileVariables[(uint16_t)(vInterruptLatencyMaxIdx)] = 0; // start a new measurement period
+	volatileVariables[(uint16_t)(vInjectorCloseMaxLengthIdx)] = 0;
+
+	SREG = oldSREG; // restore interrupt flag status
+
+	// the entry jitter is only sampled when timer0 overflows, and wraps at 256 timer0 ticks, so it does not bound how long
+	//    interrupts were masked - it only shows how late the timer0 overflow handler tends to start
+	outputMicroseconds(PSTR("max timer0 overflow entry jitter (us) = " tcEOS), mainProgramVariables[(uint16_t)(mpDebugInterruptLatencyMaxIdx)]);
+	outputMicroseconds(PSTR("max injector close handler length (us) = " tcEOS), mainProgramVariables[(uint16_t)(mpDebugInjectorCloseMaxIdx)]);
+
+}
+
+static void terminal::outputMicroseconds(const char * labelStr, uint32_t t0Cycles)
+{
+
+	text::stringOut(devDebugTerminal, labelStr);
+	SWEET64::init64((union union_64 *)(&s64reg[s64reg2]), t0Cycles * 64ul / systemProcessorSpeed); // timer0 counts once every 64 system clock cycles
+	text::stringOut(devDebugTerminal, ull2str(nBuff, 0, tFormatToNumber));
+	text::newLine(devDebugTerminal);
+
+}
+
+#endif // defined(useDebugCPUreading)
 static void terminal::mainProcess(void)
 {
 
@@ -652,6 +759,7 @@ entered at the prompt, separated by space characters. Pressing <Enter> will caus
                 short (l, c, r, u, d)
                  long (L, C, R, U, D)
            S - toggles display status line echo to terminal
+           J - lists worst-case timer0 overflow entry jitter and fuel injector close handler time since the last J, in us
            ? - displays this help
 
 	numbers or button presses are separated by spaces
@@ -879,6 +987,22 @@ entered at the prompt, separated by space characters. Pressing <Enter> will caus
 						break;
 
 #endif // defined(useDebugTerminalHelp)
+					case 'B':	// benchmark text output on each output device
+					case 'Q':	// list output buffer status for each output device
+						if (terminalMode & tmButtonInput) chr = '\\'; // if in button injection mode, reset input mode and pending command
+						else outputDeviceList(chr);
+
+						break;
+
+#if defined(useDebugCPUreading)
+					case 'J':	// list worst-case timer0 overflow entry jitter and injector handler figures
+						if (terminalMode & tmButtonInput) chr = '\\'; // if in button injection mode, reset input mode and pending command
+						else outputLatency();
+
+						break;
+
+#endif // defined(useDebugCPUreading)
+
 					case 'S':	// toggle display status line echo to terminal
 						if (terminalMode & tmButtonInput) chr = '\\'; // if in button injection mode, reset input mode and pending command
 						else
@@ -937,6 +1061,26 @@ entered at the prompt, separated by space characters. Pressing <Enter> will caus
 						terminalMode = tmInitButton; // shift to reading button press words
 						break;
 
+#if defined(useParameterTransfer)
+					case 'G':	// get all settings parameters as one checksummed frame
+						if (terminalMode & tmButtonInput) chr = '\\'; // if in button injection mode, reset input mode and pending command
+						else paramTransfer::exportFrame(devDebugTerminal);
+
+						break;
+
+					case 'W':	// write all settings parameters from one checksummed frame
+						if (terminalMode & tmButtonInput) chr = '\\'; // if in button injection mode, reset input mode and pending command
+						else
+						{
+
+							paramTransfer::importReset();
+							terminalState = 40; // the frame is read straight from the input device, bypassing line input
+
+						}
+
+						break;
+
+#endif // defined(useParameterTransfer)
 					case '+':	// add
 					case '-':	// subtract
 					case '*':	// multiply
@@ -1150,8 +1294,20 @@ entered at the prompt, separated by space characters. Pressing <Enter> will caus
 								text::hexByteOut(devDebugTerminal, FEvSpdTripIdx);
 								text::newLine(devDebugTerminal);
 
+								text::stringOut(devDebugTerminal, PSTR("FEvSbucketIdx = " tcEOS));
+								text::hexByteOut(devDebugTerminal, FEvSbucketIdx);
+								text::newLine(devDebugTerminal);
+
 #endif // defined(useBarFuelEconVsSpeed)
 #if defined(useDebugCPUreading)
+#if defined(use4BitLCD)
+								// two data nybbles per character, sampled over one main loop
+								text::stringOut(devDebugTerminal, PSTR("LCD characters per second = " tcEOS));
+								text::hexDWordOut(devDebugTerminal, mainProgramVariables[(uint16_t)(mpDebugCountLCDnybbleIdx)] * loopsPerSecond / 2);
+								text::newLine(devDebugTerminal);
+
+#endif // defined(use4BitLCD)
+
 								monitorState = 1; // set up to perform interrupt handler execution time measurement
 
 #endif // defined(useDebugCPUreading)
@@ -1386,6 +1542,35 @@ entered at the prompt, separated by space characters. Pressing <Enter> will caus
 			break;
 
 #endif // defined(useDebugButtonInjection)
+#if defined(useParameterTransfer)
+		case 40:	// feed input characters to the parameter transfer frame reader
+			while ((i = text::charIn(devDebugTerminal)))
+			{
+
+				if (i == 0x18) // ctrl-X aborts frame reception
+				{
+
+					text::charOut(devDebugTerminal, '\\');
+					terminalState = 0;
+					break;
+
+				}
+
+				i = paramTransfer::importChar(i);
+
+				if (i != ptsBusy)
+				{
+
+					paramTransfer::statusOut(devDebugTerminal, i);
+					terminalState = 0;
+					break;
+
+				}
+
+			}
+			break;
+
+#endif // defined(useParameterTransfer)
 		case 32:	// output list of selected items
 			separatorPtr = terminalPrimarySeparator;
 			text::hexByteOut(devDebugTerminal, terminalLine);
@@ -251,15 +251,21 @@ static void accelerationTest::triggerTest(void)
 static void accelerationTest::idleProcess(void)
 {
 
+#if !defined(useSeqlockTripAccess)
 	uint8_t oldSREG;
+#endif // !defined(useSeqlockTripAccess)
 	uint8_t i;
 
+#if defined(useSeqlockTripAccess)
+	accelTestStatus = accelerationFlags; // copy accel test flag status to this loop - a single byte read cannot be torn
+#else // defined(useSeqlockTripAccess)
 	oldSREG = SREG; // save interrupt flag status
 	cli(); // disable interrupts to make the next operations atomic
 
 	accelTestStatus = accelerationFlags; // copy accel test flag status to this loop
 
 	SREG = oldSREG; // restore interrupt flag status
+#endif // defined(useSeqlockTripAccess)
 
 	i = (lastAccelTestStatus ^ accelTestStatus) & accelTestClearFlags; // detect any drag race flag changes
 
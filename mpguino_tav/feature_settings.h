@@ -42,6 +42,12 @@ static const uint8_t displayCountSettingsDisplay = 2
 #if defined(useDataLoggingOutput)
 	+ 1
 #endif // defined(useDataLoggingOutput)
+#if defined(useDataLogDelta)
+	+ 1
+#endif // defined(useDataLogDelta)
+#if defined(useDataLogFieldList)
+	+ 1
+#endif // defined(useDataLogFieldList)
 #if defined(useJSONoutput)
 	+ 1
 #endif // defined(useJSONoutput)
@@ -49,8 +55,11 @@ static const uint8_t displayCountSettingsDisplay = 2
 	+ 1
 #endif // defined(useBarFuelEconVsTime)
 #if defined(useBarFuelEconVsSpeed)
-	+ 2
+	+ 3
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useEWMAtripFilter)
+	+ 1
+#endif // defined(useEWMAtripFilter)
 ;
 
 static const uint8_t displayCountSettingsFuel = 5
@@ -87,6 +96,9 @@ static const uint8_t displayCountSettingsTimeout = 7
 #if defined(useSavedTrips)
 	+ 1
 #endif // defined(useSavedTrips)
+#if defined(useTripJournal)
+	+ 1
+#endif // defined(useTripJournal)
 ;
 
 static const uint8_t displayCountSettingsVSS = 3;
@@ -139,19 +151,33 @@ static const char settingsSubMenuTitles[] PROGMEM = {	// each title must be no l
 #if defined(useCarVoltageOutput)
 	"V(diode)*1000" tcEOSCR
 #endif // defined(useCarVoltageOutput)
-#if defined(useDataLoggingOutput)
+#if defined(useBinaryLogging)
+	"DLog 1-CSV 2-Bin" tcEOSCR
+#elif defined(useDataLoggingOutput)
 	"DLogSerial 1-Yes" tcEOSCR
-#endif // defined(useDataLoggingOutput)
-#if defined(useJSONoutput)
+#endif // defined(useBinaryLogging)
+#if defined(useDataLogDelta)
+	"DLog Delta %" tcEOSCR
+#endif // defined(useDataLogDelta)
+#if defined(useDataLogFieldList)
+	"DLog Every Nth" tcEOSCR
+#endif // defined(useDataLogFieldList)
+#if defined(useJSONoutput) && defined(useBinaryLogging)
+	"JSON 1-Yes 2-Bin" tcEOSCR
+#elif defined(useJSONoutput)
 	"JSONoutput 1-Yes" tcEOSCR
-#endif // defined(useJSONoutput)
+#endif // defined(useJSONoutput) && defined(useBinaryLogging)
 #if defined(useBarFuelEconVsTime)
 	"FE/Time Period s" tcEOSCR
 #endif // defined(useBarFuelEconVsTime)
 #if defined(useBarFuelEconVsSpeed)
 	"bgLower*1000 " tcOMOFF "MPH" tcOTOG "kph" tcOON tcEOSCR
 	"bgSize*1000 " tcOMOFF "MPH" tcOTOG "kph" tcOON tcEOSCR
+	"bgLogScale 1-Yes" tcEOSCR
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useEWMAtripFilter)
+	"InstFilter Tau s" tcEOSCR
+#endif // defined(useEWMAtripFilter)
 
 // fuel injection settings
 
@@ -233,6 +259,9 @@ static const char settingsSubMenuTitles[] PROGMEM = {	// each title must be no l
 #if defined(useSavedTrips)
 	"AutoSaveTrip 1-Y" tcEOSCR
 #endif // defined(useSavedTrips)
+#if defined(useTripJournal)
+	"AutoSave Min" tcEOSCR
+#endif // defined(useTripJournal)
 
 // miscellaneous settings
 
@@ -266,6 +295,12 @@ static const char settingsParameterList[] PROGMEM = {
 #if defined(useDataLoggingOutput)
 	,pSerialDataLoggingIdx
 #endif // defined(useDataLoggingOutput)
+#if defined(useDataLogDelta)
+	,pDataLogDeltaIdx
+#endif // defined(useDataLogDelta)
+#if defined(useDataLogFieldList)
+	,pDataLogDividerIdx
+#endif // defined(useDataLogFieldList)
 #if defined(useJSONoutput)
 	,pJSONoutputIdx
 #endif // defined(useJSONoutput)
@@ -275,7 +310,11 @@ static const char settingsParameterList[] PROGMEM = {
 #if defined(useBarFuelEconVsSpeed)
 	,pBarLowSpeedCutoffIdx
 	,pBarSpeedQuantumIdx
+	,pBarSpeedScaleIdx
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useEWMAtripFilter)
+	,pEWMAtimeConstantIdx
+#endif // defined(useEWMAtripFilter)
 
 // fuel injection settings
 
@@ -352,6 +391,9 @@ static const char settingsParameterList[] PROGMEM = {
 #if defined(useSavedTrips)
 	,pAutoSaveActiveIdx
 #endif // defined(useSavedTrips)
+#if defined(useTripJournal)
+	,pJournalIntervalIdx
+#endif // defined(useTripJournal)
 
 // miscellaneous settings
 
@@ -320,7 +320,8 @@ static uint8_t parameterEdit::onEEPROMchange(const uint8_t * sched, uint8_t para
 
 	retVal = 0;
 
-	metricFlag &= ~(detectEEPROMchangeFlag);
+	metricFlag &= ~(detectEEPROMchangeFlag | EEPROMbulkChangeFlag); // a bulk change flag left over from an earlier write must not trigger a dependent reset here
+	derivedValueFlags = 0;
 
 	SWEET64::runPrgm(sched, parameterIdx);
 
@@ -328,7 +329,13 @@ static uint8_t parameterEdit::onEEPROMchange(const uint8_t * sched, uint8_t para
 	if (metricFlag & calculateFuelParamFlag) SWEET64::runPrgm(prgmCalculateFuelFactor, 0); // calculate and store microseconds per US gallon factor
 
 #endif // useCalculatedFuelFactor
-	if (metricFlag & metricConversionFlag) SWEET64::runPrgm(prgmDoEEPROMmetricConversion, 0); // if metric flag has changed
+	if (metricFlag & metricConversionFlag) // if metric flag has changed
+	{
+
+		SWEET64::runPrgm(prgmDoEEPROMmetricConversion, 0);
+		metricFlag |= (softInitGuinoFlag); // a global unit change affects nearly everything, so perform a full software init
+
+	}
 
 	if (metricFlag & changeDisplayFlag)
 	{
@@ -368,6 +375,13 @@ static uint8_t parameterEdit::onEEPROMchange(const uint8_t * sched, uint8_t para
 	if (metricFlag & hardInitGuinoFlag) EEPROM::initGuinoHardware();
 
 	if (metricFlag & softInitGuinoFlag) EEPROM::initGuinoSoftware();
+	else
+	{
+
+		if (derivedValueFlags) EEPROM::recomputeDerivedValues(derivedValueFlags); // only recalculate what the changed parameter feeds
+		if (metricFlag & EEPROMbulkChangeFlag) EEPROM::resetDependents(parameterIdx);
+
+	}
 
 	if (metricFlag & detectEEPROMchangeFlag) retVal = 1; // if the setting has changed
 
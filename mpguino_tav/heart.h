@@ -29,19 +29,28 @@ typedef struct
 {
 
 	volatile uint8_t * data;
-	volatile uint8_t size;
+	volatile uint8_t mask;
 	volatile uint8_t start;
 	volatile uint8_t end;
 	volatile uint8_t status;
+	volatile uint16_t dropCount;
 
 } ringBufferVariable;
 
+// ring buffer storage size must be a power of two, from 2 to 256 bytes - put this right after each ring buffer storage definition,
+//    so that a bad size stops the build with a negative array size error instead of quietly corrupting the buffer
+#define ringBufferSizeCheck(storage) typedef uint8_t storage##SizeCheck[((sizeof(storage) < 2) || (sizeof(storage) > 256) || (sizeof(storage) & (sizeof(storage) - 1))) ? -1 : 1]
+
 namespace ringBuffer // ringBuffer prototype
 {
 
-	static void init(ringBufferVariable &bfr, volatile uint8_t * storage);
+	static void init(ringBufferVariable &bfr, volatile uint8_t * storage, uint16_t size, uint8_t policy);
+	static void setPolicy(ringBufferVariable &bfr, uint8_t policy);
 	static uint8_t isBufferNotEmpty(ringBufferVariable &bfr);
+	static uint16_t freeSpace(ringBufferVariable &bfr);
+	static void waitForSpace(ringBufferVariable &bfr);
 	static void push(ringBufferVariable &bfr, uint8_t value);
+	static void pushBlock(ringBufferVariable &bfr, const uint8_t * data, uint8_t length);
 	static void pushInterrupt(ringBufferVariable &bfr, uint8_t value);
 	static uint8_t pull(ringBufferVariable &bfr);
 	static uint8_t pullMain(ringBufferVariable &bfr);
@@ -51,6 +60,15 @@ namespace ringBuffer // ringBuffer prototype
 
 static const uint8_t bufferIsFull =		0b10000000;
 static const uint8_t bufferIsEmpty =	0b01000000;
+static const uint8_t bufferIsStalled =	0b00100000;
+
+// what push does when the buffer is full
+static const uint8_t bufferPolicyBlock =		0b00000000; // wait for space, however long it takes
+static const uint8_t bufferPolicyDeadline =		0b00000001; // wait for space up to bufferDeadlineCycles, then drop new bytes until the buffer drains
+static const uint8_t bufferPolicyDropNewest =	0b00000010; // drop the new byte
+static const uint8_t bufferPolicyDropOldest =	0b00000011; // overwrite the oldest byte in the buffer
+
+static const uint8_t bufferPolicyMask =			0b00000011;
 
 #endif // defined(useBuffering)
 #if defined(useBarGraph)
@@ -65,6 +83,10 @@ typedef struct
   uint8_t controlFlags;
   void (* chrOut)(uint8_t character);
   uint8_t (* chrIn)(void);
+#if defined(useBuffering)
+  void (* blkOut)(const uint8_t * data, uint8_t length); // optional - accepts a run of printable characters at once
+  ringBufferVariable * outputBuffer; // optional - lets producers check for free space before starting a record
+#endif // defined(useBuffering)
 
 } interfaceDevice;
 
@@ -128,6 +150,9 @@ static const unsigned int delay0002msTick = (unsigned int)(ceil)((double)(t0Cycl
 static const unsigned int delay0005msTick = (unsigned int)(ceil)((double)(t0CyclesPerSecond) / (double)(256ul * 200ul)) - 1; // 5 millisecond delay
 static const unsigned int delay0020msTick = (unsigned int)(ceil)((double)(t0CyclesPerSecond) / (double)(256ul * 50ul)) - 1; // 20 millisecond delay
 static const unsigned int delay0100msTick = (unsigned int)(ceil)((double)(t0CyclesPerSecond) / (double)(256ul * 10ul)) - 1; // 100 millisecond delay
+#if defined(useBuffering)
+static const unsigned long bufferDeadlineCycles = t0CyclesPerSecond / 200ul; // 5 millisecond wait for output buffer space
+#endif // defined(useBuffering)
 
 #if defined(useLegacyButtons)
 static const unsigned int buttonDebounceTick = (unsigned int)(ceil)((double)(t0CyclesPerSecond) / (double)(256ul * 20ul)) - 1; // 50 millisecond delay button debounce
@@ -176,7 +201,13 @@ static const uint8_t vFEvsTimePeriodTimeoutIdx =	nextAllowedValue;				// time pe
 #endif // defined(useBarFuelEconVsTime)
 #if defined(useDebugCPUreading)
 static const uint8_t vInterruptAccumulatorIdx =		nextAllowedValue;				// interrupt handler stopwatch direct measurement
-#define nextAllowedValue vInterruptAccumulatorIdx + 1
+static const uint8_t vInterruptLatencyMaxIdx =		vInterruptAccumulatorIdx + 1;	// longest observed timer0 overflow interrupt entry jitter
+static const uint8_t vInjectorCloseMaxLengthIdx =	vInterruptLatencyMaxIdx + 1;	// longest observed fuel injector close interrupt handler execution time
+#define nextAllowedValue vInjectorCloseMaxLengthIdx + 1
+#if defined(use4BitLCD)
+static const uint8_t vLCDdataNybbleCountIdx =		nextAllowedValue;				// count of character data nybbles strobed into a 4-bit LCD
+#define nextAllowedValue vLCDdataNybbleCountIdx + 1
+#endif // defined(use4BitLCD)
 #endif // defined(useDebugCPUreading)
 
 #if defined(useDragRaceFunction)
@@ -236,6 +267,13 @@ static const uint8_t mpFEvsSpeedQuantumIdx =		mpFEvsSpeedMinThresholdIdx + 1;		/
 #define nextAllowedValue mpFEvsSpeedQuantumIdx + 1
 
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useEWMAtripFilter)
+static const uint8_t mpEWMAsampleCountIdx =			nextAllowedValue;					// filtered trip time constant in samples
+static const uint8_t mpEWMAfractionIdx =			mpEWMAsampleCountIdx + 1;			// fractional part of each filtered trip variable field, in 1/256 units
+static const uint8_t mpEWMAfractionEndIdx =			mpEWMAfractionIdx + 4;				// ensure there are as many of these as there are trip variable fields
+#define nextAllowedValue mpEWMAfractionEndIdx + 1
+
+#endif // defined(useEWMAtripFilter)
 #if defined(useCPUreading)
 static const uint8_t mpAvailableRAMidx =			nextAllowedValue;					// amount of remaining free RAM
 #define nextAllowedValue mpAvailableRAMidx + 1
@@ -258,7 +296,13 @@ static const uint8_t mpDebugAccS64multIdx =			mpDebugAccSWEET64idx + 1;			// mul
 static const uint8_t mpDebugCountS64multIdx =		mpDebugAccS64multIdx + 1;			// mult64 direct measurement counter
 static const uint8_t mpDebugAccS64divIdx =			mpDebugCountS64multIdx + 1;			// div64 stopwatch direct measurement
 static const uint8_t mpDebugCountS64divIdx =		mpDebugAccS64divIdx + 1;			// div64 direct measurement counter
-#define nextAllowedValue mpDebugCountS64divIdx + 1
+static const uint8_t mpDebugInterruptLatencyMaxIdx =	mpDebugCountS64divIdx + 1;		// copy of longest observed timer0 overflow interrupt entry jitter
+static const uint8_t mpDebugInjectorCloseMaxIdx =	mpDebugInterruptLatencyMaxIdx + 1;	// copy of longest observed fuel injector close handler execution time
+#define nextAllowedValue mpDebugInjectorCloseMaxIdx + 1
+#if defined(use4BitLCD)
+static const uint8_t mpDebugCountLCDnybbleIdx =		nextAllowedValue;					// copy of LCD character data nybble count for one main loop
+#define nextAllowedValue mpDebugCountLCDnybbleIdx + 1
+#endif // defined(use4BitLCD)
 #if defined(useIsqrt)
 static const uint8_t mpDebugAccS64sqrtIdx =			nextAllowedValue;					// iSqrt stopwatch direct measurement
 static const uint8_t mpDebugCountS64sqrtIdx =		mpDebugAccS64sqrtIdx + 1;			// iSqrt direct measurement counter
@@ -300,6 +344,11 @@ static const char terminalVolatileVarLabels[] PROGMEM = {
 #endif // defined(useBarFuelEconVsTime)
 #if defined(useDebugCPUreading)
 	"vInterruptAccumulatorIdx" tcEOS			// all interrupts
+	"vInterruptLatencyMaxIdx" tcEOS				// timer0
+	"vInjectorCloseMaxLengthIdx" tcEOS			// fi close
+#if defined(use4BitLCD)
+	"vLCDdataNybbleCountIdx" tcEOS				// timer1, or main program if LCD output is not buffered
+#endif // defined(use4BitLCD)
 #endif // defined(useDebugCPUreading)
 #if defined(useDragRaceFunction)
 	"vDragRawInstantSpeedIdx" tcEOS				// vss
@@ -344,6 +393,14 @@ static const char terminalMainProgramVarLabels[] PROGMEM = {
 	"mpFEvsSpeedMinThresholdIdx" tcEOS			// main program only
 	"mpFEvsSpeedQuantumIdx" tcEOS				// main program only
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useEWMAtripFilter)
+	"mpEWMAsampleCountIdx" tcEOS				// main program only
+	"mpEWMAfractionIdx[0]" tcEOS				// main program only
+	"mpEWMAfractionIdx[1]" tcEOS				// main program only
+	"mpEWMAfractionIdx[2]" tcEOS				// main program only
+	"mpEWMAfractionIdx[3]" tcEOS				// main program only
+	"mpEWMAfractionIdx[4]" tcEOS				// main program only
+#endif // defined(useEWMAtripFilter)
 #if defined(useCPUreading)
 	"mpAvailableRAMidx" tcEOS					// main program only
 #endif // defined(useCPUreading)
@@ -362,6 +419,11 @@ static const char terminalMainProgramVarLabels[] PROGMEM = {
 	"mpDebugCountS64multIdx" tcEOS				// main program only
 	"mpDebugAccS64divIdx" tcEOS					// main program only
 	"mpDebugCountS64divIdx" tcEOS				// main program only
+	"mpDebugInterruptLatencyMaxIdx" tcEOS		// main program only
+	"mpDebugInjectorCloseMaxIdx" tcEOS			// main program only
+#if defined(use4BitLCD)
+	"mpDebugCountLCDnybbleIdx" tcEOS			// main program only
+#endif // defined(use4BitLCD)
 #if defined(useIsqrt)
 	"mpDebugAccS64sqrtIdx" tcEOS				// main program only
 	"mpDebugCountS64sqrtIdx" tcEOS				// main program only
@@ -44,6 +44,14 @@ ISR( TIMER0_OVF_vect ) // system timer interrupt handler
 	static uint8_t TWIsampleState;
 #endif // defined(useTWIbuttons)
 	uint32_t thisTime;
+#if defined(useDebugCPUreading)
+	uint8_t a;
+
+	// timer0 count upon entry is how late this overflow interrupt handler started, whether held off by masked interrupts or by
+	//    another interrupt handler - it wraps at 256 ticks, so it is entry jitter, not a bound on masked interrupt time
+	a = TCNT0;
+	if (a > volatileVariables[(uint16_t)(vInterruptLatencyMaxIdx)]) volatileVariables[(uint16_t)(vInterruptLatencyMaxIdx)] = a;
+#endif // defined(useDebugCPUreading)
 
 	if (timer0Command & t0cResetTimer)
 	{
@@ -254,6 +262,9 @@ ISR( TIMER0_OVF_vect ) // system timer interrupt handler
 
 		timer0Command &= ~(t0cResetFEvTime);
 		tripVar::reset(FEvTperiodIdx); // reset source trip variable
+#if defined(useSeqlockTripAccess)
+		tripSeqCount++; // signal to main program that trip data has changed
+#endif // defined(useSeqlockTripAccess)
 		FEvTimeCount = volatileVariables[(uint16_t)(vFEvsTimePeriodTimeoutIdx)];
 
 	}
@@ -1245,7 +1256,10 @@ ISR( INT1_vect )
 	c = (unsigned int)(TCNT0); // do a microSeconds() - like read to determine loop length in cycles
 	if (TIFR0 & (1 << TOV0)) c = (unsigned int)(TCNT0) + 256; // if overflow occurred, re-read with overflow flag taken into account
 
-	volatileVariables[(uint16_t)(vInterruptAccumulatorIdx)] += c - a;
+	c -= a;
+
+	volatileVariables[(uint16_t)(vInterruptAccumulatorIdx)] += c;
+	if (c > volatileVariables[(uint16_t)(vInjectorCloseMaxLengthIdx)]) volatileVariables[(uint16_t)(vInjectorCloseMaxLengthIdx)] = c;
 
 #endif // defined(useDebugCPUreading)
 }
@@ -1318,7 +1332,8 @@ ISR( PCINT1_vect )
 }
 
 #if defined(useBuffering)
-static void ringBuffer::init(ringBufferVariable &bfr, volatile uint8_t * storage)
+// storage size must be a power of two, from 2 to 256 bytes
+static void ringBuffer::init(ringBufferVariable &bfr, volatile uint8_t * storage, uint16_t size, uint8_t policy)
 {
 
 	uint8_t oldSREG;
@@ -1327,15 +1342,23 @@ static void ringBuffer::init(ringBufferVariable &bfr, volatile uint8_t * storage
 	cli(); // disable interrupts
 
 	bfr.data = storage;
-	bfr.size = sizeof(storage) / sizeof(storage[0]);
+	bfr.mask = (uint8_t)(size - 1);
 	bfr.start = 0;
 	bfr.end = 0;
-	bfr.status = bufferIsEmpty;
+	bfr.status = bufferIsEmpty | (policy & bufferPolicyMask);
+	bfr.dropCount = 0;
 
 	SREG = oldSREG; // restore interrupt flag status
 
 }
 
+static void ringBuffer::setPolicy(ringBufferVariable &bfr, uint8_t policy)
+{
+
+	heart::changeBitFlags(bfr.status, (bufferPolicyMask | bufferIsStalled), (policy & bufferPolicyMask));
+
+}
+
 static uint8_t ringBuffer::isBufferNotEmpty(ringBufferVariable &bfr)
 {
 
@@ -1343,12 +1366,69 @@ static uint8_t ringBuffer::isBufferNotEmpty(ringBufferVariable &bfr)
 
 }
 
+static uint16_t ringBuffer::freeSpace(ringBufferVariable &bfr)
+{
+
+	uint16_t i;
+	uint8_t oldSREG;
+
+	oldSREG = SREG; // save interrupt flag status
+	cli(); // disable interrupts
+
+	if (bfr.status & bufferIsFull) i = 0;
+	else i = (uint16_t)((uint8_t)(bfr.end - bfr.start - 1) & bfr.mask) + 1;
+
+	SREG = oldSREG; // restore interrupt flag status
+
+	return i;
+
+}
+
+// waits for the calling routine's buffer to become not full, for as long as its policy allows
+static void ringBuffer::waitForSpace(ringBufferVariable &bfr)
+{
+
+	uint32_t startCycle;
+
+	switch (bfr.status & (bufferPolicyMask | bufferIsStalled))
+	{
+
+		case bufferPolicyBlock:
+			while (bfr.status & bufferIsFull) idleProcess();
+			break;
+
+		case bufferPolicyDeadline:
+			startCycle = heart::cycles0();
+
+			while (bfr.status & bufferIsFull)
+			{
+
+				if (heart::findCycle0Length(startCycle) >= bufferDeadlineCycles)
+				{
+
+					heart::changeBitFlags(bfr.status, 0, bufferIsStalled); // stop waiting on this buffer until it drains
+					break;
+
+				}
+
+				idleProcess();
+
+			}
+			break;
+
+		default: // drop policies, and stalled buffers, do not wait
+			break;
+
+	}
+
+}
+
 static void ringBuffer::push(ringBufferVariable &bfr, uint8_t value)
 {
 
 	uint8_t oldSREG;
 
-	while (bfr.status & bufferIsFull) idleProcess(); // wait for calling routine's buffer to become not full
+	waitForSpace(bfr);
 
 	oldSREG = SREG; // save interrupt flag status
 	cli(); // disable interrupts
@@ -1359,14 +1439,59 @@ static void ringBuffer::push(ringBufferVariable &bfr, uint8_t value)
 
 }
 
+// copies as much of the block as will fit into the buffer at once, so interrupts get disabled once per block rather than once per byte
+//
+// if the block is longer than the buffer, whatever drains the buffer must already be running
+static void ringBuffer::pushBlock(ringBufferVariable &bfr, const uint8_t * data, uint8_t length)
+{
+
+	uint8_t oldSREG;
+
+	while (length)
+	{
+
+		waitForSpace(bfr);
+
+		oldSREG = SREG; // save interrupt flag status
+		cli(); // disable interrupts
+
+		do
+		{
+
+			pushInterrupt(bfr, *data++);
+			length--;
+
+		}
+		while ((length) && ((bfr.status & bufferIsFull) == 0));
+
+		SREG = oldSREG; // restore interrupt flag status
+
+	}
+
+}
+
 static void ringBuffer::pushInterrupt(ringBufferVariable &bfr, uint8_t value)
 {
 
-	bfr.data[(uint16_t)(bfr.start++)] = value; // save a buffered character
+	if (bfr.status & bufferIsFull)
+	{
+
+		if (bfr.dropCount < 65535) bfr.dropCount++;
+
+		if ((bfr.status & bufferPolicyMask) == bufferPolicyDropOldest) bfr.end = (bfr.end + 1) & bfr.mask; // make room by discarding the oldest byte
+
+	}
+
+	if ((bfr.start != bfr.end) || (bfr.status & bufferIsEmpty)) // if there is room, save the new byte - otherwise, it gets discarded
+	{
+
+		bfr.data[(uint16_t)(bfr.start)] = value; // save a buffered character
+		bfr.start = (bfr.start + 1) & bfr.mask; // handle wrap-around
 
-	if (bfr.status & bufferIsEmpty) bfr.status &= ~(bufferIsEmpty); // mark buffer as no longer empty
-	if (bfr.start == bfr.size) bfr.start = 0; // handle wrap-around
-	if (bfr.start == bfr.end) bfr.status |= (bufferIsFull); // test if buffer is full
+		if (bfr.status & bufferIsEmpty) bfr.status &= ~(bufferIsEmpty); // mark buffer as no longer empty
+		if (bfr.start == bfr.end) bfr.status |= (bufferIsFull); // test if buffer is full
+
+	}
 
 }
 
@@ -1396,11 +1521,11 @@ static uint8_t ringBuffer::pull(ringBufferVariable &bfr)
 	else
 	{
 
-		value = bfr.data[(uint16_t)(bfr.end++)]; // pull a buffered character
+		value = bfr.data[(uint16_t)(bfr.end)]; // pull a buffered character
+		bfr.end = (bfr.end + 1) & bfr.mask; // handle wrap-around
 
 		if (bfr.status & bufferIsFull) bfr.status &= ~(bufferIsFull); // mark buffer as no longer full
-		if (bfr.end == bfr.size) bfr.end = 0; // handle wrap-around
-		if (bfr.end == bfr.start) bfr.status |= (bufferIsEmpty); // test if buffer is empty
+		if (bfr.end == bfr.start) bfr.status = (bfr.status & ~(bufferIsStalled)) | bufferIsEmpty; // test if buffer is empty, which also ends any stall
 
 	}
 
@@ -1408,10 +1533,22 @@ static uint8_t ringBuffer::pull(ringBufferVariable &bfr)
 
 }
 
+// waits for the calling routine's buffer to become empty - only a blocking buffer waits indefinitely
 static void ringBuffer::flush(ringBufferVariable &bfr)
 {
 
-	while ((bfr.status & bufferIsEmpty) == 0) idleProcess(); // wait for calling routine's buffer to become empty
+	uint32_t startCycle;
+
+	startCycle = heart::cycles0();
+
+	while ((bfr.status & bufferIsEmpty) == 0)
+	{
+
+		if (((bfr.status & bufferPolicyMask) != bufferPolicyBlock) && (heart::findCycle0Length(startCycle) >= bufferDeadlineCycles)) break;
+
+		idleProcess();
+
+	}
 
 }
 
@@ -2105,6 +2242,10 @@ static void heart::doGoDeepSleep(void)
 #endif // defined(__AVR_ATmega328P__)
 
 #endif // defined(useTimer1)
+#if defined(useEEPROMwriteQueue)
+	EEPROM::flush(); // EEPROM ready interrupt cannot wake MPGuino from power-down sleep, so finish all EEPROM writes now
+
+#endif // defined(useEEPROMwriteQueue)
 	performSleepMode(SLEEP_MODE_PWR_DOWN); // go perform power-down sleep mode
 
 	initHardware(); // restart all peripherals
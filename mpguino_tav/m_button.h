@@ -114,6 +114,12 @@ static const uint8_t dfBarFEvTdisplay =			dfSplitScreen | dfUsesCGRAM;
 #if defined(useBarFuelEconVsSpeed)
 static const uint8_t dfBarFEvSdisplay =			dfSplitScreen | dfUsesCGRAM;
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useBarEngineLoad)
+static const uint8_t dfBarEngineLoadDisplay =	dfSplitScreen | dfUsesCGRAM;
+#endif // defined(useBarEngineLoad)
+#if defined(useFuelLog)
+static const uint8_t dfFuelLogDisplay =			dfMainDisplay;
+#endif // defined(useFuelLog)
 #if defined(useBigDTE)
 static const uint8_t dfBigDTEdisplay =			dfSplitScreen | dfUsesCGRAM | dfUsesCGRAMfont;
 #endif // defined(useBigDTE)
@@ -585,6 +591,58 @@ static const buttonVariable bpListSecondaryDisplay[] PROGMEM = {
 };
 
 #endif // defined(useBigDigitDisplay) || defined(useStatusMeter) || defined(useCPUreading) || defined(useBarGraph)
+#if defined(useFuelLog)
+static const buttonVariable bpListFuelLog[] PROGMEM = {
+	 {btnShortPressR,	cursor::shortRight}
+	,{btnShortPressL,	cursor::shortLeft}
+	,{btnLongPressR,	cursor::longRight}
+	,{btnLongPressL,	cursor::longLeft}
+#if LCDcharHeight == 4
+	,{btnLongPressC,	cursor::transferDisplay}
+#endif // LCDcharHeight == 4
+#if defined(useDataLoggingOutput)
+	,{btnShortPressLR,	fuelLog::outputDataLog}
+#endif // defined(useDataLoggingOutput)
+#if defined(useButtonCrossConfig)
+		,{btnShortPressD,	cursor::longRight}
+	#if defined(useLCDoutput)
+		,{btnShortPressU,	cursor::doNextBright}
+	#endif // defined(useLCDoutput)
+		,{btnShortPressC,	mainDisplay::goToMenu}
+	#if defined(useEnhancedTripReset)
+		,{btnShortPressUL,	tripSave::goSaveTank}
+		,{btnLongPressUL,	tripSave::goSaveTank}
+	#else // defined(useEnhancedTripReset)
+		,{btnLongPressUL,	tripSupport::resetTank}
+	#endif // defined(useEnhancedTripReset)
+	#if defined(useSavedTrips)
+		,{btnShortPressUR,	tripSave::goSaveCurrent}
+		,{btnLongPressUR,	tripSave::goSaveCurrent}
+	#else // defined(useSavedTrips)
+		,{btnLongPressUR,	tripSupport::resetCurrent}
+	#endif // defined(useSavedTrips)
+#else // defined(useButtonCrossConfig)
+	#if defined(useLCDoutput)
+		,{btnShortPressC,	cursor::doNextBright}
+	#endif // defined(useLCDoutput)
+		,{btnShortPressLCR,	mainDisplay::goToMenu}
+	#if defined(useEnhancedTripReset)
+		,{btnShortPressLC,	tripSave::goSaveTank}
+		,{btnLongPressLC,	tripSave::goSaveTank}
+	#else // defined(useEnhancedTripReset)
+		,{btnLongPressLC,	tripSupport::resetTank}
+	#endif // defined(useEnhancedTripReset)
+	#if defined(useSavedTrips)
+		,{btnShortPressCR,	tripSave::goSaveCurrent}
+		,{btnLongPressCR,	tripSave::goSaveCurrent}
+	#else // defined(useSavedTrips)
+		,{btnLongPressCR,	tripSupport::resetCurrent}
+	#endif // defined(useSavedTrips)
+#endif // defined(useButtonCrossConfig)
+	,{buttonsUp,		cursor::noSupport}
+};
+
+#endif // defined(useFuelLog)
 #if defined(useClockDisplay)
 static const buttonVariable bpListClockDisplay[] PROGMEM = {
 	 {btnShortPressR,	cursor::shortRight}
@@ -767,6 +825,12 @@ static const displayData displayParameters[(uint16_t)(displayCountTotal)] PROGME
 #if defined(useBarFuelEconVsSpeed)
 	,{mainDisplayIdx,				displayCountUser,	3,								dfBarFEvSdisplay,				barGraphSupport::displayHandler,	bpListSecondaryDisplay}
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useBarEngineLoad)
+	,{mainDisplayIdx,				displayCountUser,	6,								dfBarEngineLoadDisplay,			barGraphSupport::displayHandler,	bpListSecondaryDisplay}
+#endif // defined(useBarEngineLoad)
+#if defined(useFuelLog)
+	,{mainDisplayIdx,				displayCountUser,	flDisplayPageCount,				dfFuelLogDisplay,				fuelLog::displayHandler,			bpListFuelLog}
+#endif // defined(useFuelLog)
 #if defined(useBigDTE)
 	,{mainDisplayIdx,				displayCountUser,	3,								dfBigDTEdisplay,				bigDigit::displayHandler,			bpListSecondaryDisplay}
 #endif // defined(useBigDTE)
@@ -35,12 +35,19 @@ namespace LCD /* LCD hardware support section prototype */
 	static void writeCGRAMbyte(uint8_t cgrAddress, uint8_t chr);
 	static uint8_t peekCGRAMbyte(uint8_t cgrAddress);
 	static void flushCGRAM(void);
+#if defined(useCGRAMglyphCache)
+	static void bindCGRAMcharacter(uint8_t chr, char * chrData);
+	static uint8_t translateCGRAMaddress(uint8_t cgrAddress);
+#endif // defined(useCGRAMglyphCache)
 #endif // defined(useLCDgraphics)
 #if defined(use4BitLCD)
 	static void writeCommand(uint8_t value);
 	static void writeByte(uint8_t value, uint8_t flags, uint8_t delay);
 	static void writeNybble(uint8_t value, uint8_t flags);
 	static void outputNybble(uint8_t s);
+#if defined(useLCDframeBuffer)
+	static void writeFrameChar(uint8_t value);
+#endif // defined(useLCDframeBuffer)
 #endif // defined(use4BitLCD)
 
 };
@@ -51,6 +58,7 @@ interfaceDevice devLCD;
 ringBufferVariable lcdBuffer;
 
 static volatile uint8_t LCDdata[32];
+ringBufferSizeCheck(LCDdata);
 
 #endif // defined(useLCDbufferedOutput)
 // these flags provide flow control for the LCD::writeData character output routine
@@ -67,6 +75,16 @@ static const uint8_t cgramFlagDirty =		0b10000000;
 
 static uint8_t CGRAMbuffer[64]; // used by LCD output routine
 
+#if defined(useCGRAMglyphCache)
+// CGRAM character codes 0 through 7 are logical - each one is bound to whichever physical CGRAM slot holds its glyph
+//
+// a glyph that is already resident in any slot is reused rather than re-sent, and a glyph that is not resident
+// evicts the slot that has gone the most CGRAM flushes without being used
+static uint8_t CGRAMslotMap[8]; // translates logical CGRAM character codes into physical CGRAM slots
+static uint8_t CGRAMslotAge[8]; // number of CGRAM flushes since each physical slot was last used
+static uint8_t CGRAMslotUsed; // bitmask of physical slots used since the last CGRAM flush
+
+#endif // defined(useCGRAMglyphCache)
 #endif // defined(useLCDgraphics)
 #if defined(use4BitLCD)
 #if defined(usePort4BitLCD)
@@ -130,6 +148,12 @@ static const uint8_t lcdContrast =			0; // not used
 #endif // defined(usePort4BitLCD)
 #if defined(useTWI4BitLCD)
 static volatile uint8_t portLCD; // LCD port register expander byte
+#if !defined(useLCDbufferedOutput)
+static uint8_t lcdTWIflags; // lets LCD::writeByte send both nybbles of a character within one TWI transmission
+
+static const uint8_t lcdTWIholdOpen =		0b00000010; // do not commit the TWI transmission after this nybble
+static const uint8_t lcdTWIchannelOpen =	0b00000001; // a TWI transmission is being built up
+#endif // !defined(useLCDbufferedOutput)
 #if defined(useAdafruitRGBLCDshield)
 static volatile uint8_t portSwitches; // contains two out of the three LCD backlighting LED pins
 
@@ -233,6 +257,20 @@ static const uint8_t lcdBaseYposition[] PROGMEM = {
 	,lcdSetDDRAMaddress | 0x54
 };
 
+#if defined(useLCDframeBuffer)
+// the frame buffer holds what the LCD screen is currently showing, so that redrawing a screen only sends the characters that changed
+//
+// gotoXY requests are not sent to the LCD right away. Instead, LCD::writeFrameChar only sends a DDRAM address command when the LCD
+//    address counter is not already pointing at the character being changed
+static const uint8_t lcdFrameSize =					LCDcharWidth * LCDcharHeight;
+static const uint8_t lcdFrameUnknown =				0xFF;	// never sent to the LCD as a character, so a cell holding this always gets redrawn
+static const uint8_t lcdAddressUnknown =			0xFF;	// never matches any DDRAM address command
+
+static uint8_t LCDframe[(uint16_t)(lcdFrameSize)];
+static uint8_t LCDdeviceAddress;	// DDRAM address command that matches the LCD address counter
+static uint8_t LCDcursorShown;		// if the LCD cursor or character blink is showing, gotoXY requests are sent right away
+
+#endif // defined(useLCDframeBuffer)
 static const uint8_t lcdDisplayModes[] PROGMEM = {
 	 lcdDisplayControl																		// turn off display
 	,lcdDisplayControl | lcdDCdisplayShow													// turn on display, no cursor, no character blink (default)
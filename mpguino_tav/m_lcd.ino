@@ -6,6 +6,9 @@ static void LCD::init(void)
 
 #if defined(useSerialLCD)
 	devLCDserial.controlFlags &= ~(odvFlagCRLF);
+#if defined(LCDserialBuffer)
+	ringBuffer::setPolicy(LCDserialBuffer, bufferPolicyBlock); // dropping bytes would corrupt serial LCD commands
+#endif // defined(LCDserialBuffer)
 
 	heart::wait0(delay0100msTick); // wait for 100 ms to allow serial LCD to initialize
 
@@ -20,7 +23,7 @@ static void LCD::init(void)
 	devLCD.controlFlags |= (odvFlagEnableOutput);
 
 #if defined(useLCDbufferedOutput)
-	ringBuffer::init(lcdBuffer, LCDdata);
+	ringBuffer::init(lcdBuffer, LCDdata, sizeof(LCDdata), bufferPolicyBlock); // dropping LCD nybbles would desynchronize the LCD
 
 #endif // defined(useLCDbufferedOutput)
 	lcdDelayCount = 0; // reset LCD delay count
@@ -127,6 +130,13 @@ static void LCD::init(void)
 	// ready to use normal LCD output function now!
 	writeCommand(lcdFunctionSet | lcdFSnumberOfLines); // 4-bit interface, 2 display lines, 5x8 font
 
+#if defined(useLCDframeBuffer)
+	for (uint8_t x = 0; x < lcdFrameSize; x++) LCDframe[(uint16_t)(x)] = lcdFrameUnknown; // screen contents are unknown, so the upcoming clear screen redraws every cell
+
+	LCDdeviceAddress = lcdAddressUnknown;
+	LCDcursorShown = 0;
+
+#endif // defined(useLCDframeBuffer)
 #if defined(useLCDbufferedOutput)
 	ringBuffer::flush(lcdBuffer); // flush LCD output buffer
 
@@ -135,6 +145,18 @@ static void LCD::init(void)
 #if defined(useLCDgraphics)
 	for (uint8_t x = 0; x < 64; x++) CGRAMbuffer[(uint16_t)(x)] = cgramFlagDirty;
 
+#if defined(useCGRAMglyphCache)
+	for (uint8_t x = 0; x < 8; x++)
+	{
+
+		CGRAMslotMap[(uint16_t)(x)] = x;
+		CGRAMslotAge[(uint16_t)(x)] = 0;
+
+	}
+
+	CGRAMslotUsed = 0;
+
+#endif // defined(useCGRAMglyphCache)
 #endif // defined(useLCDgraphics)
 #if defined(useLCDcontrast)
 	setContrast(EEPROM::readByte(pContrastIdx));
@@ -379,10 +401,24 @@ static void LCD::loadCGRAMfont(const char * fontPtr)
 {
 
 	uint8_t numChars;
+#if defined(useCGRAMglyphCache)
+	char chrData[8];
+#endif // defined(useCGRAMglyphCache)
 
 	numChars = pgm_read_byte(fontPtr++); // get the number of characters in the font
 
+#if defined(useCGRAMglyphCache)
+	for (uint8_t chr = 0; chr < numChars; chr++)
+	{
+
+		for (uint8_t x = 0; x < 8; x++) chrData[(uint16_t)(x)] = pgm_read_byte(fontPtr++);
+
+		loadCGRAMcharacter(chr, chrData); // go find or allocate a CGRAM slot for this character
+
+	}
+#else // defined(useCGRAMglyphCache)
 	for (uint8_t chr = 0; chr < numChars * 8; chr++) writeCGRAMbyte(chr, pgm_read_byte(fontPtr++)); // copy the CGRAM character data into RAM
+#endif // defined(useCGRAMglyphCache)
 
 }
 
@@ -393,7 +429,13 @@ static void LCD::loadCGRAMcharacter(uint8_t chr, char * chrData)
 
 	uint8_t cgrAddress;
 
-	cgrAddress = ((chr & 0x07) << 3);
+	chr &= 0x07;
+
+#if defined(useCGRAMglyphCache)
+	bindCGRAMcharacter(chr, chrData);
+
+#endif // defined(useCGRAMglyphCache)
+	cgrAddress = (chr << 3);
 
 	for (uint8_t x = 0; x < 8; x++) writeCGRAMbyte(cgrAddress + x, (*chrData++) & 0x1F);
 
@@ -402,6 +444,10 @@ static void LCD::loadCGRAMcharacter(uint8_t chr, char * chrData)
 static void LCD::writeCGRAMbyte(uint8_t cgrAddress, uint8_t chr)
 {
 
+#if defined(useCGRAMglyphCache)
+	cgrAddress = translateCGRAMaddress(cgrAddress);
+
+#endif // defined(useCGRAMglyphCache)
 	// if there is any bit change in the CGRAM byte
 	if ((chr ^ CGRAMbuffer[(uint16_t)(cgrAddress)]) & 0x9F) CGRAMbuffer[(uint16_t)(cgrAddress)] = (chr | cgramFlagDirty);
 
@@ -410,6 +456,10 @@ static void LCD::writeCGRAMbyte(uint8_t cgrAddress, uint8_t chr)
 static uint8_t LCD::peekCGRAMbyte(uint8_t cgrAddress)
 {
 
+#if defined(useCGRAMglyphCache)
+	cgrAddress = translateCGRAMaddress(cgrAddress);
+
+#endif // defined(useCGRAMglyphCache)
 	// if there is any bit change in the CGRAM byte
 	return CGRAMbuffer[(uint16_t)(cgrAddress)] & 0x1F;
 
@@ -453,7 +503,15 @@ static void LCD::flushCGRAM(void)
 
 	}
 
-	if (f) writeCommand(LCDgotoXYaddress); // set DDRAM to whatever the screen position was
+	if (f)
+	{
+
+		writeCommand(LCDgotoXYaddress); // set DDRAM to whatever the screen position was
+#if defined(useLCDframeBuffer)
+		LCDdeviceAddress = LCDgotoXYaddress;
+#endif // defined(useLCDframeBuffer)
+
+	}
 
 #endif // defined(use4BitLCD)
 #if defined(useSerialLCD)
@@ -489,8 +547,90 @@ static void LCD::flushCGRAM(void)
 	// clear dirty flag on every byte in the buffer
 	for (cgrAddress = 0; cgrAddress < 64; cgrAddress++) CGRAMbuffer[(uint16_t)(cgrAddress)] &= ~(cgramFlagDirty);
 
+#if defined(useCGRAMglyphCache)
+	// age every slot that went unused since the last flush
+	for (y = 0; y < 8; y++)
+	{
+
+		if (CGRAMslotUsed & (1 << y)) CGRAMslotAge[(uint16_t)(y)] = 0;
+		else if (CGRAMslotAge[(uint16_t)(y)] < 255) CGRAMslotAge[(uint16_t)(y)]++;
+
+	}
+
+	CGRAMslotUsed = 0;
+
+#endif // defined(useCGRAMglyphCache)
 }
 
+#if defined(useCGRAMglyphCache)
+// binds a logical CGRAM character to a physical slot for the supplied glyph
+//
+// a slot that already holds the glyph is preferred, so the glyph does not get sent again. Otherwise, the least
+// recently used slot is taken. Slots used by other characters since the last flush are left alone, because they
+// may already be on screen. Whichever character was bound to the chosen slot takes over the vacated slot.
+static void LCD::bindCGRAMcharacter(uint8_t chr, char * chrData)
+{
+
+	uint8_t oldSlot;
+	uint8_t newSlot;
+	uint8_t cgrAddress;
+	uint8_t age;
+	uint8_t x;
+	uint8_t y;
+
+	oldSlot = CGRAMslotMap[(uint16_t)(chr)];
+	newSlot = 0xFF;
+
+	// look for a slot that already holds this glyph
+	for (x = 0; (x < 8) && (newSlot == 0xFF); x++)
+		if ((x == oldSlot) || ((CGRAMslotUsed & (1 << x)) == 0))
+		{
+
+			cgrAddress = (x << 3);
+
+			for (y = 0; y < 8; y++) if ((CGRAMbuffer[(uint16_t)(cgrAddress + y)] ^ chrData[(uint16_t)(y)]) & 0x1F) break;
+
+			if (y == 8) newSlot = x;
+
+		}
+
+	// otherwise, evict the least recently used slot, favoring this character's own slot on a tie
+	if (newSlot == 0xFF)
+	{
+
+		age = 0;
+
+		for (x = 0; x < 8; x++)
+			if ((x == oldSlot) || ((CGRAMslotUsed & (1 << x)) == 0))
+				if ((newSlot == 0xFF) || (CGRAMslotAge[(uint16_t)(x)] > age) || ((CGRAMslotAge[(uint16_t)(x)] == age) && (x == oldSlot)))
+				{
+
+					newSlot = x;
+					age = CGRAMslotAge[(uint16_t)(x)];
+
+				}
+
+	}
+
+	for (x = 0; x < 8; x++) if (CGRAMslotMap[(uint16_t)(x)] == newSlot) CGRAMslotMap[(uint16_t)(x)] = oldSlot;
+
+	CGRAMslotMap[(uint16_t)(chr)] = newSlot;
+
+}
+
+static uint8_t LCD::translateCGRAMaddress(uint8_t cgrAddress)
+{
+
+	uint8_t slot;
+
+	slot = CGRAMslotMap[(uint16_t)((cgrAddress >> 3) & 0x07)];
+	CGRAMslotUsed |= (1 << slot); // mark this slot as in use, so it does not get evicted before the next flush
+
+	return ((slot << 3) | (cgrAddress & 0x07));
+
+}
+
+#endif // defined(useCGRAMglyphCache)
 #endif // defined(useLCDgraphics)
 static void LCD::writeData(uint8_t value)
 {
@@ -525,7 +665,11 @@ static void LCD::writeData(uint8_t value)
 				{
 
 #if defined(use4BitLCD)
+#if defined(useLCDframeBuffer)
+					if (LCDaddressY < LCDcharHeight) writeFrameChar(' ');
+#else // defined(useLCDframeBuffer)
 					writeByte(' ', lcdDataByte, lcdDelay0040us);
+#endif // defined(useLCDframeBuffer)
 #endif // defined(use4BitLCD)
 #if defined(useSerialLCD)
 					LCDserialPort::chrOut(' ');
@@ -543,7 +687,14 @@ static void LCD::writeData(uint8_t value)
 
 		case 0x0C: // clear screen
 #if defined(use4BitLCD)
+#if defined(useLCDframeBuffer)
+			// blank out only those cells that are not already blank, instead of waiting out the clear display command
+			for (LCDaddressY = 0; LCDaddressY < LCDcharHeight; LCDaddressY++)
+				for (LCDaddressX = 0; LCDaddressX < LCDcharWidth; LCDaddressX++) writeFrameChar(' ');
+
+#else // defined(useLCDframeBuffer)
 			writeCommand(lcdClearDisplay); // clear display, set cursor position to zero
+#endif // defined(useLCDframeBuffer)
 			charFlags |= (lcdCharGotoXY);
 #endif // defined(use4BitLCD)
 #if defined(useSerialLCD)
@@ -569,6 +720,16 @@ static void LCD::writeData(uint8_t value)
 #if defined(use4BitLCD)
 			x = value - 0x15;
 			writeCommand(pgm_read_byte(&lcdDisplayModes[(uint16_t)(x)])); // set display mode
+#if defined(useLCDframeBuffer)
+			if (value > 0x16)
+			{
+
+				LCDcursorShown = 1;
+				charFlags |= (lcdCharGotoXY); // bring the visible cursor to the current screen position
+
+			}
+			else LCDcursorShown = 0;
+#endif // defined(useLCDframeBuffer)
 #endif // defined(use4BitLCD)
 #if defined(useSerialLCD)
 			charFlags |= (lcdCharOutput);
@@ -583,6 +744,10 @@ static void LCD::writeData(uint8_t value)
 			break;
 
 		case 0x00 ... 0x07: // print defined CGRAM characters 0 through 7
+#if defined(useCGRAMglyphCache)
+			value = CGRAMslotMap[(uint16_t)(value)]; // print whichever physical slot holds this character's glyph
+
+#endif // defined(useCGRAMglyphCache)
 		case 0x20 ... 0x7F: // print normal characters
 #if defined(blankScreenOnMessage)
 			if (timer0DisplayDelayFlags == 0)
@@ -591,7 +756,11 @@ static void LCD::writeData(uint8_t value)
 #endif // defined(blankScreenOnMessage)
 			{
 
+#if defined(useLCDframeBuffer)
+				if ((LCDaddressX < LCDcharWidth) && (LCDaddressY < LCDcharHeight)) writeFrameChar(value);
+#else // defined(useLCDframeBuffer)
 				if ((LCDaddressX < LCDcharWidth) && (LCDaddressY < LCDcharHeight)) charFlags |= (lcdCharOutput);
+#endif // defined(useLCDframeBuffer)
 				LCDaddressX++;
 
 			}
@@ -615,7 +784,17 @@ static void LCD::writeData(uint8_t value)
 	{
 
 #if defined(use4BitLCD)
+#if defined(useLCDframeBuffer)
+		if ((LCDcursorShown) && (LCDdeviceAddress != LCDgotoXYaddress)) // otherwise, leave it to writeFrameChar
+		{
+
+			writeCommand(LCDgotoXYaddress);
+			LCDdeviceAddress = LCDgotoXYaddress;
+
+		}
+#else // defined(useLCDframeBuffer)
 		writeCommand(LCDgotoXYaddress);
+#endif // defined(useLCDframeBuffer)
 #endif // defined(use4BitLCD)
 #if defined(useSerialLCD)
 		LCDserialPort::chrOut(0x80 + LCDaddressY * 20 + LCDaddressX);
@@ -628,6 +807,9 @@ static void LCD::writeData(uint8_t value)
 
 #if defined(use4BitLCD)
 		writeByte(value, lcdDataByte, lcdDelay0040us);
+#if defined(useLCDframeBuffer)
+		LCDdeviceAddress = lcdAddressUnknown; // this character did not go through the frame buffer
+#endif // defined(useLCDframeBuffer)
 #endif // defined(use4BitLCD)
 #if defined(useSerialLCD)
 		LCDserialPort::chrOut(value);
@@ -639,6 +821,34 @@ static void LCD::writeData(uint8_t value)
 }
 
 #if defined(use4BitLCD)
+#if defined(useLCDframeBuffer)
+// sends a character to the current screen position, but only if the LCD is not already showing it there
+static void LCD::writeFrameChar(uint8_t value)
+{
+
+	uint8_t i;
+	uint8_t address;
+
+	i = LCDaddressY * LCDcharWidth + LCDaddressX;
+
+	if (LCDframe[(uint16_t)(i)] != value)
+	{
+
+		LCDframe[(uint16_t)(i)] = value;
+
+		address = pgm_read_byte(&lcdBaseYposition[(uint16_t)(LCDaddressY)]) + LCDaddressX;
+
+		if (LCDdeviceAddress != address) writeCommand(address); // skip the DDRAM address command if the LCD address counter is already there
+
+		writeByte(value, lcdDataByte, lcdDelay0040us);
+
+		LCDdeviceAddress = address + 1; // the LCD address counter advances after each character
+
+	}
+
+}
+
+#endif // defined(useLCDframeBuffer)
 static void LCD::writeCommand(uint8_t value)
 {
 
@@ -668,7 +878,13 @@ static void LCD::writeByte(uint8_t value, uint8_t flags, uint8_t delay)
 
 	flags |= lcdSendNybble;
 
+#if defined(useTWI4BitLCD) && !defined(useLCDbufferedOutput)
+	lcdTWIflags |= (lcdTWIholdOpen); // pack both nybbles, with all four enable strobes, into one TWI transmission
+#endif // defined(useTWI4BitLCD) && !defined(useLCDbufferedOutput)
 	writeNybble(value, (flags | lcdDelay0040us)); // send the high nybble with standard 40 us delay
+#if defined(useTWI4BitLCD) && !defined(useLCDbufferedOutput)
+	lcdTWIflags &= ~(lcdTWIholdOpen);
+#endif // defined(useTWI4BitLCD) && !defined(useLCDbufferedOutput)
 	writeNybble(value << 4, (flags | delay)); // send the low nybble with the specified delay
 
 }
@@ -683,10 +899,10 @@ static void LCD::writeNybble(uint8_t value, uint8_t flags)
 	uint8_t oldSREG;
 
 #endif // defined(usePort4BitLCD)
-	while (timer1Command & t1cDelayLCD) idleProcess(); // wait for LCD timer delay to complete
-
 #if defined(useTWI4BitLCD)
-	if (flags & lcdSendNybble)
+	if ((lcdTWIflags & lcdTWIchannelOpen) == 0) while (timer1Command & t1cDelayLCD) idleProcess(); // wait for LCD timer delay to complete
+
+	if ((flags & lcdSendNybble) && ((lcdTWIflags & lcdTWIchannelOpen) == 0))
 	{
 
 #if defined(useInterruptBasedTWI)
@@ -696,9 +912,13 @@ static void LCD::writeNybble(uint8_t value, uint8_t flags)
 #if defined(useAdafruitRGBLCDshield)
 		TWI::writeByte(MCP23017_B1_OLATB); // specify bank B output latch register address
 #endif // defined(useAdafruitRGBLCDshield)
+		lcdTWIflags |= (lcdTWIchannelOpen);
 
 	}
 
+#else // defined(useTWI4BitLCD)
+	while (timer1Command & t1cDelayLCD) idleProcess(); // wait for LCD timer delay to complete
+
 #endif // defined(useTWI4BitLCD)
 #if defined(usePort4BitLCD)
 	oldSREG = SREG; // save interrupt flag status
@@ -712,13 +932,14 @@ static void LCD::writeNybble(uint8_t value, uint8_t flags)
 #endif // defined(usePort4BitLCD)
 #if defined(useTWI4BitLCD)
 
-	if (flags & lcdSendNybble)
+	if (lcdTWIflags == lcdTWIchannelOpen) // if a transmission was built up, and it is not being held open for the next nybble
 	{
 
 		TWI::transmitChannel(TWI_STOP); // commit LCD port expander write
 #if defined(useInterruptBasedTWI)
 		TWI::enableISRactivity(); // enable ISR-based TWI activity
 #endif // defined(useInterruptBasedTWI)
+		lcdTWIflags = 0;
 
 	}
 #endif // defined(useTWI4BitLCD)
@@ -733,6 +954,10 @@ static void LCD::outputNybble(uint8_t LCDchar)
 
 	uint8_t x;
 
+#if defined(useDebugCPUreading)
+	if ((LCDchar & (lcdSendNybble | lcdDataByte)) == (lcdSendNybble | lcdDataByte)) volatileVariables[(uint16_t)(vLCDdataNybbleCountIdx)]++;
+
+#endif // defined(useDebugCPUreading)
 	if (LCDchar & lcdSendNybble)
 	{
 
@@ -873,12 +1098,11 @@ static void LCD::outputNybble(uint8_t LCDchar)
 			break;
 
 		case lcdDelay0040us:
-			lcdDelayCount += delayLCD000040usTick;
-			break;
-
 		case lcdDataByte | lcdDelay0040us:
+#if !defined(useTWI4BitLCD)
 			lcdDelayCount += delayLCD000040usTick;
-			break;
+#endif // !defined(useTWI4BitLCD)
+			break; // for TWI, the next enable strobe is always at least two port expander writes away, which already takes longer than 40 us
 
 		default:
 			lcdDelayCount += delayLCD004100usTick;
@@ -5,6 +5,9 @@ namespace serial0
 	static void init(void);
 	static void shutdown(void);
 	static void chrOut(uint8_t chr);
+#if defined(useBufferedSerial0Port)
+	static void blkOut(const uint8_t * data, uint8_t length);
+#endif // defined(useBufferedSerial0Port)
 #if defined(useSerial0PortInput)
 	static uint8_t chrIn(void);
 #endif // defined(useSerial0PortInput)
@@ -17,12 +20,14 @@ interfaceDevice devSerial0;
 ringBufferVariable serial0Buffer;
 
 volatile uint8_t serial0Data[32];
+ringBufferSizeCheck(serial0Data);
 
 #endif // defined(useBufferedSerial0Port)
 #if defined(useSerial0PortInput)
 ringBufferVariable serial0InputBuffer;
 
 volatile uint8_t serial0InputData[16];
+ringBufferSizeCheck(serial0InputData);
 
 #endif // defined(useSerial0PortInput)
 #endif // defined(useSerial0Port)
@@ -34,6 +39,9 @@ namespace serial1
 	static void init(void);
 	static void shutdown(void);
 	static void chrOut(uint8_t chr);
+#if defined(useBufferedSerial1Port)
+	static void blkOut(const uint8_t * data, uint8_t length);
+#endif // defined(useBufferedSerial1Port)
 #if defined(useSerial1PortInput)
 	static uint8_t chrIn(void);
 #endif // defined(useSerial1PortInput)
@@ -46,12 +54,14 @@ interfaceDevice devSerial1;
 ringBufferVariable serial1Buffer;
 
 volatile uint8_t serial1Data[32];
+ringBufferSizeCheck(serial1Data);
 
 #endif // defined(useBufferedSerial1Port)
 #if defined(useSerial1PortInput)
 ringBufferVariable serial1InputBuffer;
 
 volatile uint8_t serial1InputData[16];
+ringBufferSizeCheck(serial1InputData);
 
 #endif // defined(useSerial1PortInput)
 #endif // defined(useSerial1Port)
@@ -62,6 +72,9 @@ namespace serial2
 	static void init(void);
 	static void shutdown(void);
 	static void chrOut(uint8_t chr);
+#if defined(useBufferedSerial2Port)
+	static void blkOut(const uint8_t * data, uint8_t length);
+#endif // defined(useBufferedSerial2Port)
 #if defined(useSerial2PortInput)
 	static uint8_t chrIn(void);
 #endif // defined(useSerial2PortInput)
@@ -74,12 +87,14 @@ interfaceDevice devSerial2;
 ringBufferVariable serial2Buffer;
 
 volatile uint8_t serial2Data[32];
+ringBufferSizeCheck(serial2Data);
 
 #endif // defined(useBufferedSerial2Port)
 #if defined(useSerial2PortInput)
 ringBufferVariable serial2InputBuffer;
 
 volatile uint8_t serial2InputData[16];
+ringBufferSizeCheck(serial2InputData);
 
 #endif // defined(useSerial2PortInput)
 #endif // defined(useSerial2Port)
@@ -90,6 +105,9 @@ namespace serial3
 	static void init(void);
 	static void shutdown(void);
 	static void chrOut(uint8_t chr);
+#if defined(useBufferedSerial3Port)
+	static void blkOut(const uint8_t * data, uint8_t length);
+#endif // defined(useBufferedSerial3Port)
 #if defined(useSerial3PortInput)
 	static uint8_t chrIn(void);
 #endif // defined(useSerial3PortInput)
@@ -102,12 +120,14 @@ interfaceDevice devSerial3;
 ringBufferVariable serial3Buffer;
 
 volatile uint8_t serial3Data[32];
+ringBufferSizeCheck(serial3Data);
 
 #endif // defined(useBufferedSerial3Port)
 #if defined(useSerial3PortInput)
 ringBufferVariable serial3InputBuffer;
 
 volatile uint8_t serial3InputData[16];
+ringBufferSizeCheck(serial3InputData);
 
 #endif // defined(useSerial3PortInput)
 #endif // defined(useSerial3Port)
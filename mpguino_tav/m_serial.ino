@@ -9,11 +9,11 @@ static void serial0::init(void)
 	cli(); // disable interrupts
 
 #if defined(useBufferedSerial0Port)
-	ringBuffer::init(serial0Buffer, serial0Data);
+	ringBuffer::init(serial0Buffer, serial0Data, sizeof(serial0Data), bufferPolicyDeadline);
 
 #endif // defined(useBufferedSerial0Port)
 #if defined(useSerial0PortInput)
-	ringBuffer::init(serial0InputBuffer, serial0InputData);
+	ringBuffer::init(serial0InputBuffer, serial0InputData, sizeof(serial0InputData), bufferPolicyDropNewest);
 
 #endif // defined(useSerial0PortInput)
 	// turn on USART0 transmitter
@@ -52,6 +52,10 @@ static void serial0::init(void)
 #endif // defined(useSerial0PortInput)
 
 	devSerial0.chrOut = chrOut;
+#if defined(useBufferedSerial0Port)
+	devSerial0.blkOut = blkOut;
+	devSerial0.outputBuffer = &serial0Buffer;
+#endif // defined(useBufferedSerial0Port)
 #if defined(useSerial0PortInput)
 	devSerial0.chrIn = chrIn;
 #endif // defined(useSerial0PortInput)
@@ -89,6 +93,16 @@ static void serial0::chrOut(uint8_t chr)
 
 }
 
+#if defined(useBufferedSerial0Port)
+static void serial0::blkOut(const uint8_t * data, uint8_t length)
+{
+
+	ringBuffer::pushBlock(serial0Buffer, data, length);
+	UCSR0B |= (1 << UDRIE0); // enable data register empty interrupt
+
+}
+
+#endif // defined(useBufferedSerial0Port)
 #if defined(useSerial0PortInput)
 static uint8_t serial0::chrIn(void)
 {
@@ -179,10 +193,10 @@ static void serial1::init(void)
 	cli(); // disable interrupts
 #if defined(useBufferedSerial1Port)
 
-	ringBuffer::init(serial1Buffer, serial1Data);
+	ringBuffer::init(serial1Buffer, serial1Data, sizeof(serial1Data), bufferPolicyDeadline);
 #endif // defined(useBufferedSerial1Port)
 #if defined(useSerial1PortInput)
-	ringBuffer::init(serial1InputBuffer, serial1InputData);
+	ringBuffer::init(serial1InputBuffer, serial1InputData, sizeof(serial1InputData), bufferPolicyDropNewest);
 
 #endif // defined(useSerial1PortInput)
 	// turn on USART1 transmitter
@@ -216,6 +230,10 @@ static void serial1::init(void)
 #endif // defined(useSerial1PortInput)
 
 	devSerial1.chrOut = chrOut;
+#if defined(useBufferedSerial1Port)
+	devSerial1.blkOut = blkOut;
+	devSerial1.outputBuffer = &serial1Buffer;
+#endif // defined(useBufferedSerial1Port)
 #if defined(useSerial1PortInput)
 	devSerial1.chrIn = chrIn;
 #endif // defined(useSerial1PortInput)
@@ -248,6 +266,16 @@ static void serial1::chrOut(uint8_t chr)
 
 }
 
+#if defined(useBufferedSerial1Port)
+static void serial1::blkOut(const uint8_t * data, uint8_t length)
+{
+
+	ringBuffer::pushBlock(serial1Buffer, data, length);
+	UCSR1B |= (1 << UDRIE1); // enable data register empty interrupt
+
+}
+
+#endif // defined(useBufferedSerial1Port)
 #if defined(useSerial1PortInput)
 static uint8_t serial1::chrIn(void)
 {
@@ -333,10 +361,10 @@ static void serial2::init(void)
 	cli(); // disable interrupts
 #if defined(useBufferedSerial2Port)
 
-	ringBuffer::init(serial2Buffer, serial2Data);
+	ringBuffer::init(serial2Buffer, serial2Data, sizeof(serial2Data), bufferPolicyDeadline);
 #endif // defined(useBufferedSerial2Port)
 #if defined(useSerial2PortInput)
-	ringBuffer::init(serial2InputBuffer, serial2InputData);
+	ringBuffer::init(serial2InputBuffer, serial2InputData, sizeof(serial2InputData), bufferPolicyDropNewest);
 
 #endif // defined(useSerial2PortInput)
 	// turn on USART2 transmitter
@@ -370,6 +398,10 @@ static void serial2::init(void)
 #endif // defined(useSerial2PortInput)
 
 	devSerial2.chrOut = chrOut;
+#if defined(useBufferedSerial2Port)
+	devSerial2.blkOut = blkOut;
+	devSerial2.outputBuffer = &serial2Buffer;
+#endif // defined(useBufferedSerial2Port)
 #if defined(useSerial2PortInput)
 	devSerial2.chrIn = chrIn;
 #endif // defined(useSerial2PortInput)
@@ -402,6 +434,16 @@ static void serial2::chrOut(uint8_t chr)
 
 }
 
+#if defined(useBufferedSerial2Port)
+static void serial2::blkOut(const uint8_t * data, uint8_t length)
+{
+
+	ringBuffer::pushBlock(serial2Buffer, data, length);
+	UCSR2B |= (1 << UDRIE2); // enable data register empty interrupt
+
+}
+
+#endif // defined(useBufferedSerial2Port)
 #if defined(useSerial2PortInput)
 static uint8_t serial2::chrIn(void)
 {
@@ -482,10 +524,10 @@ static void serial3::init(void)
 	cli(); // disable interrupts
 #if defined(useBufferedSerial3Port)
 
-	ringBuffer::init(serial3Buffer, serial3Data);
+	ringBuffer::init(serial3Buffer, serial3Data, sizeof(serial3Data), bufferPolicyDeadline);
 #endif // defined(useBufferedSerial3Port)
 #if defined(useSerial3PortInput)
-	ringBuffer::init(serial3InputBuffer, serial3InputData);
+	ringBuffer::init(serial3InputBuffer, serial3InputData, sizeof(serial3InputData), bufferPolicyDropNewest);
 
 #endif // defined(useSerial3PortInput)
 	// turn on USART3 transmitter
@@ -519,6 +561,10 @@ static void serial3::init(void)
 #endif // defined(useSerial3PortInput)
 
 	devSerial3.chrOut = chrOut;
+#if defined(useBufferedSerial3Port)
+	devSerial3.blkOut = blkOut;
+	devSerial3.outputBuffer = &serial3Buffer;
+#endif // defined(useBufferedSerial3Port)
 #if defined(useSerial3PortInput)
 	devSerial3.chrIn = chrIn;
 #endif // defined(useSerial3PortInput)
@@ -551,6 +597,16 @@ static void serial3::chrOut(uint8_t chr)
 
 }
 
+#if defined(useBufferedSerial3Port)
+static void serial3::blkOut(const uint8_t * data, uint8_t length)
+{
+
+	ringBuffer::pushBlock(serial3Buffer, data, length);
+	UCSR3B |= (1 << UDRIE3); // enable data register empty interrupt
+
+}
+
+#endif // defined(useBufferedSerial3Port)
 #if defined(useSerial3PortInput)
 static uint8_t serial3::chrIn(void)
 {
@@ -23,7 +23,11 @@ const uint8_t TWI_REPEAT_START =		0;
 const uint8_t TWI_STOP =				1;
 
 const unsigned int twiFrequency = 100L;
+#if defined(useTWI4BitLCD)
+const uint8_t twiDataBufferSize = 32; // room for several LCD characters, enable strobes included, in a single transmission
+#else // defined(useTWI4BitLCD)
 const uint8_t twiDataBufferSize = 16;
+#endif // defined(useTWI4BitLCD)
 
 static uint8_t twiDataBuffer[twiDataBufferSize];
 
@@ -14,6 +14,7 @@ namespace usbDevice
 	static void init(void);
 	static void shutdown(void);
 	static void chrOut(uint8_t chr);
+	static void blkOut(const uint8_t * data, uint8_t length);
 	static uint8_t chrIn(void);
 
 };
@@ -24,7 +25,9 @@ ringBufferVariable USBoutputBuffer;
 ringBufferVariable USBinputBuffer;
 
 volatile uint8_t USBoutputData[256];
+ringBufferSizeCheck(USBoutputData);
 volatile uint8_t USBinputData[256];
+ringBufferSizeCheck(USBinputData);
 
 // the time remaining before we transmit any partially full
 // packet, or send a zero length packet.
@@ -85,10 +85,12 @@ static void usbDevice::init(void)
 
 	UDIEN = ((1 << EORSTE) | (1 << SOFE)); // enable End-Of-Reset, Start-Of-Frame interrupts
 
-	ringBuffer::init(USBoutputBuffer, USBoutputData);
-	ringBuffer::init(USBinputBuffer, USBinputData);
+	ringBuffer::init(USBoutputBuffer, USBoutputData, sizeof(USBoutputData), bufferPolicyDeadline);
+	ringBuffer::init(USBinputBuffer, USBinputData, sizeof(USBinputData), bufferPolicyDropNewest);
 
 	devUSB.chrOut = chrOut;
+	devUSB.blkOut = blkOut;
+	devUSB.outputBuffer = &USBoutputBuffer;
 	devUSB.chrIn = chrIn;
 
 	SREG = oldSREG; // restore interrupt flag status
@@ -126,6 +128,13 @@ static void usbDevice::chrOut(uint8_t chr)
 
 }
 
+static void usbDevice::blkOut(const uint8_t * data, uint8_t length)
+{
+
+	ringBuffer::pushBlock(USBoutputBuffer, data, length);
+
+}
+
 static uint8_t usbDevice::chrIn(void)
 {
 
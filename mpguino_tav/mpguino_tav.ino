@@ -420,6 +420,7 @@ Logging Output / Debug Monitor I/O
 #include <avr/pgmspace.h>
 #include <avr/eeprom.h>
 #include <avr/sleep.h>
+#include <util/crc16.h>
 
 static const char titleMPGuino[] PROGMEM = {
 	tcOON "MPGuino v1.95tav" tcEOSCR
@@ -504,6 +505,10 @@ static void idleProcess(void)
 	activityLED::output(1);
 
 #endif // defined(useActivityLED)
+#if defined(useEEPROMparameterCache)
+	EEPROM::writeBackProcess(); // program any changed parameter byte into EEPROM, if EEPROM is ready for it
+
+#endif // defined(useEEPROMparameterCache)
 	// this is the part of the main loop that only executes twice a second (or what is defined by loopsPerSecond), to collect and process readings
 	if (timer0Status & t0sTakeSample) // if main timer has commanded a sample be taken
 	{
@@ -515,6 +520,10 @@ static void idleProcess(void)
 
 #endif // defined(useCPUreading) || defined(useDebugCPUreading)
 		tripSupport::idleProcess();
+#if defined(useTripJournal)
+
+		tripJournal::idleProcess();
+#endif // defined(useTripJournal)
 
 	}
 
@@ -638,6 +647,14 @@ int main(void)
 
 	heart::initHardware(); // initialize all human interface peripherals
 
+#if defined(useTripJournal)
+	tripJournal::init();
+
+#endif // defined(useTripJournal)
+#if defined(useFuelLog)
+	fuelLog::init();
+
+#endif // defined(useFuelLog)
 #if defined(useSavedTrips)
 	i = tripSave::doAutoAction(taaModeRead);
 
@@ -781,7 +798,11 @@ int main(void)
 #endif // defined(useDragRaceFunction)
 		}
 
-#if defined(useWindowTripFilter) || defined(useSavedTrips)
+#if defined(useTripJournal)
+		tripJournal::mainProcess(); // perform any pending trip autosave
+
+#endif // defined(useTripJournal)
+#if defined(useWindowTripFilter) || defined(useEWMAtripFilter) || defined(useSavedTrips) || (defined(useBarEngineLoad) && defined(useDataLoggingOutput)) || defined(useEEPROMparameterCache) || defined(useEEPROMwriteQueue)
 		if (activityChangeFlags & afParkFlag)
 		{
 
@@ -809,6 +830,14 @@ int main(void)
 				tripSupport::resetWindowFilter(); // reset the window trip filter
 
 #endif // defined(useWindowTripFilter)
+#if defined(useEWMAtripFilter)
+				tripSupport::resetEWMAfilter(); // reset the exponentially weighted trip filter
+
+#endif // defined(useEWMAtripFilter)
+#if defined(useBarEngineLoad) && defined(useDataLoggingOutput)
+				if (EEPROM::readByte(pSerialDataLoggingIdx)) bgEngineLoad::outputDataLog(); // export engine load histogram via data logging output
+
+#endif // defined(useBarEngineLoad) && defined(useDataLoggingOutput)
 #if defined(useSavedTrips)
 				i = tripSave::doAutoAction(taaModeWrite);
 #if defined(useLCDoutput)
@@ -816,11 +845,15 @@ int main(void)
 #endif // defined(useLCDoutput)
 
 #endif // defined(useSavedTrips)
+#if defined(useEEPROMparameterCache) || defined(useEEPROMwriteQueue)
+				EEPROM::flush(); // make sure all changed parameters and trips are in EEPROM before MPGuino goes to sleep
+
+#endif // defined(useEEPROMparameterCache) || defined(useEEPROMwriteQueue)
 			}
 
 		}
 
-#endif // defined(useWindowTripFilter) || defined(useSavedTrips)
+#endif // defined(useWindowTripFilter) || defined(useEWMAtripFilter) || defined(useSavedTrips) || (defined(useBarEngineLoad) && defined(useDataLoggingOutput)) || defined(useEEPROMparameterCache) || defined(useEEPROMwriteQueue)
 #if defined(useDebugTerminal)
 		terminal::mainProcess();
 
@@ -858,6 +891,21 @@ int main(void)
 		}
 
 #endif // defined(useDataLoggingOutput) || defined(useJSONoutput)
+#if defined(useDataLoggingOutput)
+		if (dataLogStep) doOutputDataLogStep(); // output the next parts of any data logging line in progress
+
+#if defined(useBinaryLogging)
+		binaryLog::outputStep(devLogOutput, blStreamLogging); // output whatever is left of any binary frame in progress
+#if defined(useJSONoutput)
+		binaryLog::outputStep(devJSONoutput, blStreamJSON);
+#endif // defined(useJSONoutput)
+
+#endif // defined(useBinaryLogging)
+#endif // defined(useDataLoggingOutput)
+#if defined(useJSONoutput)
+		if (JSONstep) doOutputJSONstep(); // output the next part of any JSON payload in progress
+
+#endif // defined(useJSONoutput)
 #if defined(useBluetooth)
 		bluetooth::mainOutput();
 
@@ -875,7 +923,7 @@ int main(void)
 
 #endif // defined(useOutputPins)
 #if defined(useBarFuelEconVsSpeed)
-			FEvSpdTripIdx = (uint8_t)(SWEET64::runPrgm(prgmFEvsSpeed, instantIdx));
+			bgFEvsSsupport::selectBucket(SWEET64::runPrgm(prgmFEvsSpeed, instantIdx));
 
 #endif // defined(useBarFuelEconVsSpeed)
 			// this section handles all MPGuino activity modes
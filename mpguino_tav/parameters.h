@@ -6,21 +6,55 @@ namespace EEPROM /* EEPROM parameter I/O section prototype */
 	static void initGuinoHardware(void);
 	static void initGuinoSoftware(void);
 	static uint8_t readByte(uint8_t eePtr);
-#if defined(useScreenEditor)
+#if defined(useScreenEditor) || defined(useDataLogFieldList)
 	static uint16_t readWord(uint8_t eePtr);
-#endif // defined(useScreenEditor)
+#endif // defined(useScreenEditor) || defined(useDataLogFieldList)
 	static void writeByte(uint8_t eePtr, uint8_t value);
-#if defined(useScreenEditor)
+#if defined(useScreenEditor) || defined(useDataLogFieldList)
 	static void writeVal(uint8_t eePtr, uint32_t value);
-#endif // defined(useScreenEditor)
+#endif // defined(useScreenEditor) || defined(useDataLogFieldList)
 	static void read64(union union_64 * an, uint8_t parameterIdx);
 	static void write64(union union_64 * an, uint8_t parameterIdx);
+	static uint32_t getDescriptor(uint8_t eePtr);
 	static uint16_t getAddress(uint8_t eePtr);
 	static uint8_t getParameterFlags(uint8_t eePtr);
 	static uint8_t getLength(uint8_t eePtr);
+	static void recomputeDerivedValues(uint8_t dvFlags);
+	static void resetDependents(uint8_t parameterIdx);
+	static uint8_t readRawByte(uint16_t address);
+	static void writeRawByte(uint16_t address, uint8_t value);
+	static uint8_t isWriteReady(void);
+	static void flush(void);
+#if defined(useEEPROMwriteQueue)
+	static void programQueuedByte(void);
+#endif // defined(useEEPROMwriteQueue)
+#if defined(useEEPROMparameterCache)
+	static void loadParameterCache(void);
+	static void writeBackProcess(void);
+	static void flushParameterCache(void);
+#endif // defined(useEEPROMparameterCache)
+
+};
+
+#if defined(useParameterTransfer)
+namespace paramTransfer /* settings parameter block bulk import/export section prototype */
+{
+
+	static void exportFrame(interfaceDevice &dev);
+	static void importReset(void);
+	static uint8_t importChar(uint8_t chr);
+	static void statusOut(interfaceDevice &dev, uint8_t status);
+	static uint8_t fetchByte(uint16_t address);
+	static uint8_t apply(void);
 
 };
 
+#endif // defined(useParameterTransfer)
+
+#if defined(useDataLogFieldList)
+static const uint8_t dataLogFieldListSize = 8; // most fields that one data logging line can carry
+
+#endif // defined(useDataLogFieldList)
 #if defined(useButtonInput)
 static const uint8_t displayCountMain = 9			// count of base number of data displays
 #if defined(trackIdleEOCdata)
@@ -127,6 +161,14 @@ static const uint8_t barFEvTdisplayIdx =			nextAllowedValue;
 static const uint8_t barFEvSdisplayIdx =			nextAllowedValue;
 #define nextAllowedValue barFEvSdisplayIdx + 1
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useBarEngineLoad)
+static const uint8_t barEngineLoadDisplayIdx =		nextAllowedValue;
+#define nextAllowedValue barEngineLoadDisplayIdx + 1
+#endif // defined(useBarEngineLoad)
+#if defined(useFuelLog)
+static const uint8_t fuelLogDisplayIdx =			nextAllowedValue;
+#define nextAllowedValue fuelLogDisplayIdx + 1
+#endif // defined(useFuelLog)
 #if defined(useBigDTE)
 static const uint8_t bigDTEdisplayIdx =				nextAllowedValue;
 #define nextAllowedValue bigDTEdisplayIdx + 1
@@ -226,19 +268,33 @@ static const uint8_t pSizeOutputPin2Mode =				3;
 #if defined(useCarVoltageOutput)
 static const uint8_t pSizeVoltageOffset =				12;
 #endif // defined(useCarVoltageOutput)
-#if defined(useDataLoggingOutput)
+#if defined(useBinaryLogging)
+static const uint8_t pSizeSerialDataLogging =			2;
+#elif defined(useDataLoggingOutput)
 static const uint8_t pSizeSerialDataLogging =			1;
-#endif // defined(useDataLoggingOutput)
-#if defined(useJSONoutput)
+#endif // defined(useBinaryLogging)
+#if defined(useDataLogDelta)
+static const uint8_t pSizeDataLogDelta =				7;
+#endif // defined(useDataLogDelta)
+#if defined(useDataLogFieldList)
+static const uint8_t pSizeDataLogDivider =				8;
+#endif // defined(useDataLogFieldList)
+#if defined(useJSONoutput) && defined(useBinaryLogging)
+static const uint8_t pSizeJSONoutput =					2;
+#elif defined(useJSONoutput)
 static const uint8_t pSizeJSONoutput =					1;
-#endif // defined(useJSONoutput)
+#endif // defined(useJSONoutput) && defined(useBinaryLogging)
 #if defined(useBarFuelEconVsTime)
 static const uint8_t pSizeFEvsTime =					16;
 #endif // defined(useBarFuelEconVsTime)
 #if defined(useBarFuelEconVsSpeed)
 static const uint8_t pSizeBarLowSpeedCutoff =			24;
 static const uint8_t pSizeBarSpeedQuantumIdx =			24;
+static const uint8_t pSizeBarSpeedScale =				1;
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useEWMAtripFilter)
+static const uint8_t pSizeEWMAtimeConstant =			8;
+#endif // defined(useEWMAtripFilter)
 #if defined(useFuelPressure)
 static const uint8_t pSizeSysFuelPressure =				32;
 #endif // defined(useFuelPressure)
@@ -280,6 +336,9 @@ static const uint8_t pSizeDragAutoFlag =				1;
 #if defined(useSavedTrips)
 static const uint8_t pSizeAutoSaveActive =				1;
 #endif // defined(useSavedTrips)
+#if defined(useTripJournal)
+static const uint8_t pSizeJournalInterval =				8;
+#endif // defined(useTripJournal)
 #if defined(usePartialRefuel)
 static const uint8_t pSizeRefuelSize =					pSizeTankSize;
 #endif // defined(usePartialRefuel)
@@ -383,6 +442,14 @@ static const uint16_t pAddressVoltageOffset =				nextAllowedValue;
 static const uint16_t pAddressSerialDataLogging =			nextAllowedValue;
 #define nextAllowedValue pAddressSerialDataLogging + byteSize(pSizeSerialDataLogging)
 #endif // defined(useDataLoggingOutput)
+#if defined(useDataLogDelta)
+static const uint16_t pAddressDataLogDelta =				nextAllowedValue;
+#define nextAllowedValue pAddressDataLogDelta + byteSize(pSizeDataLogDelta)
+#endif // defined(useDataLogDelta)
+#if defined(useDataLogFieldList)
+static const uint16_t pAddressDataLogDivider =				nextAllowedValue;
+#define nextAllowedValue pAddressDataLogDivider + byteSize(pSizeDataLogDivider)
+#endif // defined(useDataLogFieldList)
 #if defined(useJSONoutput)
 static const uint16_t pAddressJSONoutput =					nextAllowedValue;
 #define nextAllowedValue pAddressJSONoutput + byteSize(pSizeJSONoutput)
@@ -394,8 +461,13 @@ static const uint16_t pAddressFEvsTime =					nextAllowedValue;
 #if defined(useBarFuelEconVsSpeed)
 static const uint16_t pAddressBarLowSpeedCutoff =			nextAllowedValue;
 static const uint16_t pAddressBarSpeedQuantumIdx =			pAddressBarLowSpeedCutoff + byteSize(pSizeBarLowSpeedCutoff);
-#define nextAllowedValue pAddressBarSpeedQuantumIdx + byteSize(pSizeBarSpeedQuantumIdx)
+static const uint16_t pAddressBarSpeedScale =				pAddressBarSpeedQuantumIdx + byteSize(pSizeBarSpeedQuantumIdx);
+#define nextAllowedValue pAddressBarSpeedScale + byteSize(pSizeBarSpeedScale)
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useEWMAtripFilter)
+static const uint16_t pAddressEWMAtimeConstant =			nextAllowedValue;
+#define nextAllowedValue pAddressEWMAtimeConstant + byteSize(pSizeEWMAtimeConstant)
+#endif // defined(useEWMAtripFilter)
 #if defined(useFuelPressure)
 static const uint16_t pAddressSysFuelPressure =				nextAllowedValue;
 #define nextAllowedValue pAddressSysFuelPressure + byteSize(pSizeSysFuelPressure)
@@ -446,6 +518,10 @@ static const uint16_t pAddressDragAutoFlag =				pAddressDragDistance + byteSize(
 static const uint16_t pAddressAutoSaveActive =				nextAllowedValue;
 #define nextAllowedValue pAddressAutoSaveActive + byteSize(pSizeAutoSaveActive)
 #endif // defined(useSavedTrips)
+#if defined(useTripJournal)
+static const uint16_t pAddressJournalInterval =				nextAllowedValue;
+#define nextAllowedValue pAddressJournalInterval + byteSize(pSizeJournalInterval)
+#endif // defined(useTripJournal)
 #if defined(usePartialRefuel)
 static const uint16_t pAddressRefuelSize =					nextAllowedValue;
 #define nextAllowedValue pAddressRefuelSize + byteSize(pSizeRefuelSize)
@@ -460,6 +536,13 @@ static const uint16_t pAddressBottomCursorIdx =				pAddressBottomDisplayIdx + by
 #define nextAllowedValue pAddressBottomCursorIdx + byteSize(pSizeBottomCursorIdx)
 #endif // LCDcharHeight == 4
 #endif // defined(useButtonInput)
+
+static const uint16_t eeAdrParametersEnd =					nextAllowedValue;	// end of settings parameters, not counting any saved trip data
+
+#if defined(useEEPROMparameterCache)
+static const uint16_t eeAdrParameterCacheEnd =				nextAllowedValue;	// all EEPROM addresses below this one are shadowed in RAM
+
+#endif // defined(useEEPROMparameterCache)
 #if defined(useEEPROMtripStorage)
 #if defined(usePartialRefuel)
 static const uint16_t pAddressRefuelSaveSizeIdx =			nextAllowedValue;
@@ -501,6 +584,12 @@ static const uint16_t eeAdrScreensEnd =						eeAdrScreensStart + 2 * mainDisplay
 #define nextAllowedValue eeAdrScreensEnd
 
 #endif // defined(useScreenEditor)
+#if defined(useDataLogFieldList)
+static const uint16_t eeAdrDataLogFieldsStart =				nextAllowedValue;
+static const uint16_t eeAdrDataLogFieldsEnd =				eeAdrDataLogFieldsStart + 2 * dataLogFieldListSize;
+#define nextAllowedValue eeAdrDataLogFieldsEnd
+
+#endif // defined(useDataLogFieldList)
 #if defined(useButtonInput)
 static const uint16_t eeAdrDisplayCursorStart =				nextAllowedValue;
 static const uint16_t eeAdrDisplayCursorEnd =				eeAdrDisplayCursorStart + displayCountTotal;
@@ -511,6 +600,69 @@ static const uint16_t eeAdrMenuCursorEnd =					eeAdrMenuCursorStart + displayCou
 
 static const unsigned int eeAdrStorageEnd =					nextAllowedValue;
 
+#if defined(useEEPROMparameterCache)
+// RAM copy of the settings parameter section of EEPROM, laid out exactly as it is in EEPROM
+//
+// parameter reads come straight from RAM. Parameter writes update RAM right away, and mark the changed bytes as dirty.
+//    EEPROM::writeBackProcess() then programs one dirty byte at a time into EEPROM, whenever the EEPROM is not busy
+//
+uint8_t parameterCache[(uint16_t)(eeAdrParameterCacheEnd)];
+uint8_t parameterCacheDirty[(uint16_t)((eeAdrParameterCacheEnd + 7) / 8)];
+uint16_t parameterCacheWriteAdr;
+uint8_t parameterCacheDirtyFlag;
+
+#endif // defined(useEEPROMparameterCache)
+#if defined(useEEPROMwriteQueue)
+// ring of EEPROM bytes waiting to be programmed by the EEPROM ready interrupt handler
+//
+// the main program only ever adds to the head, and the interrupt handler only ever takes from the tail. Any EEPROM read first
+//    looks through the queue, as a queued byte is newer than what EEPROM holds
+//
+const uint8_t eeWriteQueueSize =			32;						// must be a power of 2
+const uint8_t eeWriteQueueMask =			eeWriteQueueSize - 1;
+
+volatile uint16_t eeWriteQueueAddress[(uint16_t)(eeWriteQueueSize)];
+volatile uint8_t eeWriteQueueData[(uint16_t)(eeWriteQueueSize)];
+volatile uint8_t eeWriteQueueHead;
+volatile uint8_t eeWriteQueueTail;
+
+#endif // defined(useEEPROMwriteQueue)
+#if defined(useParameterTransfer)
+// a parameter transfer frame is every settings parameter byte, in EEPROM order, followed by a big-endian CRC-16 of those bytes
+//
+// the frame is sent as hexadecimal text between '{' and '}', as the character input devices use 0x00 to mean "no character".
+//    Whitespace inside the frame is ignored. The leading EEPROM signature bytes double as a layout check, so a frame taken from
+//    an MPGuino built with a different parameter list gets rejected rather than scrambling every setting
+//
+static const uint16_t ptFrameLength =		eeAdrParametersEnd + 2;	// settings bytes plus CRC-16
+
+static const uint8_t ptsBusy =				0;						// frame reception still in progress
+static const uint8_t ptsOK =				1;						// frame received, verified, and stored to EEPROM
+static const uint8_t ptsBadFrame =			2;						// invalid character, or frame has wrong length
+static const uint8_t ptsBadChecksum =		3;						// CRC-16 did not match
+static const uint8_t ptsBadLayout =			4;						// frame came from an incompatible parameter layout
+
+static const char ptStatusMsgs[] PROGMEM = {
+	"busy" tcEOS
+	"OK" tcEOS
+	"bad frame" tcEOS
+	"bad checksum" tcEOS
+	"layout mismatch" tcEOS
+};
+
+static uint8_t ptBuffer[(uint16_t)(eeAdrParametersEnd)];	// staging area, so nothing gets stored unless the entire frame checks out
+static uint16_t ptByteCount;
+static uint16_t ptCRC;
+static uint16_t ptFrameCRC;
+static uint8_t ptNibble;
+static uint8_t ptState;
+
+static const uint8_t ptiWaitStart =			0;
+static const uint8_t ptiHighNibble =		1;
+static const uint8_t ptiLowNibble =			2;
+
+#endif // defined(useParameterTransfer)
+
 /* parameter indexes */
 
 #define nextAllowedValue 0
@@ -569,6 +721,14 @@ static const uint8_t pVoltageOffset =					nextAllowedValue;
 static const uint8_t pSerialDataLoggingIdx =			nextAllowedValue;
 #define nextAllowedValue pSerialDataLoggingIdx + 1
 #endif // defined(useDataLoggingOutput)
+#if defined(useDataLogDelta)
+static const uint8_t pDataLogDeltaIdx =				nextAllowedValue;
+#define nextAllowedValue pDataLogDeltaIdx + 1
+#endif // defined(useDataLogDelta)
+#if defined(useDataLogFieldList)
+static const uint8_t pDataLogDividerIdx =				nextAllowedValue;
+#define nextAllowedValue pDataLogDividerIdx + 1
+#endif // defined(useDataLogFieldList)
 #if defined(useJSONoutput)
 static const uint8_t pJSONoutputIdx =					nextAllowedValue;
 #define nextAllowedValue pJSONoutputIdx + 1
@@ -580,8 +740,13 @@ static const uint8_t pFEvsTimeIdx =						nextAllowedValue;
 #if defined(useBarFuelEconVsSpeed)
 static const uint8_t pBarLowSpeedCutoffIdx =			nextAllowedValue;
 static const uint8_t pBarSpeedQuantumIdx =				pBarLowSpeedCutoffIdx + 1;
-#define nextAllowedValue pBarSpeedQuantumIdx + 1
+static const uint8_t pBarSpeedScaleIdx =				pBarSpeedQuantumIdx + 1;
+#define nextAllowedValue pBarSpeedScaleIdx + 1
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useEWMAtripFilter)
+static const uint8_t pEWMAtimeConstantIdx =			nextAllowedValue;
+#define nextAllowedValue pEWMAtimeConstantIdx + 1
+#endif // defined(useEWMAtripFilter)
 #if defined(useFuelPressure)
 static const uint8_t pSysFuelPressureIdx =				nextAllowedValue;
 #define nextAllowedValue pSysFuelPressureIdx + 1
@@ -632,6 +797,10 @@ static const uint8_t pDragAutoFlagIdx =					pDragDistanceIdx + 1;
 static const uint8_t pAutoSaveActiveIdx =				nextAllowedValue;
 #define nextAllowedValue pAutoSaveActiveIdx + 1
 #endif // defined(useSavedTrips)
+#if defined(useTripJournal)
+static const uint8_t pJournalIntervalIdx =				nextAllowedValue;
+#define nextAllowedValue pJournalIntervalIdx + 1
+#endif // defined(useTripJournal)
 #if defined(usePartialRefuel)
 static const uint8_t pRefuelSizeIdx =					nextAllowedValue;
 #define nextAllowedValue pRefuelSizeIdx + 1
@@ -700,6 +869,12 @@ static const uint8_t eePtrDisplayPagesEnd =				eePtrDisplayPagesStart + mainDisp
 #define nextAllowedValue eePtrDisplayPagesEnd
 
 #endif // defined(useScreenEditor)
+#if defined(useDataLogFieldList)
+static const uint8_t eePtrDataLogFieldsStart =			nextAllowedValue;
+static const uint8_t eePtrDataLogFieldsEnd =			eePtrDataLogFieldsStart + dataLogFieldListSize;
+#define nextAllowedValue eePtrDataLogFieldsEnd
+
+#endif // defined(useDataLogFieldList)
 #if defined(useButtonInput)
 static const uint16_t eePtrDisplayCursorStart =			nextAllowedValue;
 static const uint16_t eePtrDisplayCursorEnd =			eePtrDisplayCursorStart + displayCountTotal;
@@ -759,6 +934,12 @@ static const char terminalParameterNames[] PROGMEM = {
 #if defined(useDataLoggingOutput)
 	"pSerialDataLoggingIdx" tcEOS
 #endif // defined(useDataLoggingOutput)
+#if defined(useDataLogDelta)
+	"pDataLogDeltaIdx" tcEOS
+#endif // defined(useDataLogDelta)
+#if defined(useDataLogFieldList)
+	"pDataLogDividerIdx" tcEOS
+#endif // defined(useDataLogFieldList)
 #if defined(useJSONoutput)
 	"pJSONoutputIdx" tcEOS
 #endif // defined(useJSONoutput)
@@ -768,7 +949,11 @@ static const char terminalParameterNames[] PROGMEM = {
 #if defined(useBarFuelEconVsSpeed)
 	"pBarLowSpeedCutoffIdx" tcEOS
 	"pBarSpeedQuantumIdx" tcEOS
+	"pBarSpeedScaleIdx" tcEOS
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useEWMAtripFilter)
+	"pEWMAtimeConstantIdx" tcEOS
+#endif // defined(useEWMAtripFilter)
 #if defined(useFuelPressure)
 	"pSysFuelPressureIdx" tcEOS
 #endif // defined(useFuelPressure)
@@ -810,6 +995,9 @@ static const char terminalParameterNames[] PROGMEM = {
 #if defined(useSavedTrips)
 	"pAutoSaveActiveIdx" tcEOS
 #endif // defined(useSavedTrips)
+#if defined(useTripJournal)
+	"pJournalIntervalIdx" tcEOS
+#endif // defined(useTripJournal)
 #if defined(usePartialRefuel)
 	"pRefuelSizeIdx" tcEOS
 #endif // defined(usePartialRefuel)
@@ -916,6 +1104,17 @@ static const char terminalParameterNames[] PROGMEM = {
 	"P11F03" tcEOS
 
 #endif // defined(useScreenEditor)
+#if defined(useDataLogFieldList)
+	"DLogField0" tcEOS
+	"DLogField1" tcEOS
+	"DLogField2" tcEOS
+	"DLogField3" tcEOS
+	"DLogField4" tcEOS
+	"DLogField5" tcEOS
+	"DLogField6" tcEOS
+	"DLogField7" tcEOS
+
+#endif // defined(useDataLogFieldList)
 
 #if defined(useButtonInput)
 	"baseMenuDisplayIdx" tcEOS
@@ -976,6 +1175,12 @@ static const char terminalParameterNames[] PROGMEM = {
 #if defined(useBarFuelEconVsSpeed)
 	"barFEvSdisplayIdx" tcEOS
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useBarEngineLoad)
+	"barEngineLoadDisplayIdx" tcEOS
+#endif // defined(useBarEngineLoad)
+#if defined(useFuelLog)
+	"fuelLogDisplayIdx" tcEOS
+#endif // defined(useFuelLog)
 #if defined(useBigDTE)
 	"bigDTEdisplayIdx" tcEOS
 #endif // defined(useBigDTE)
@@ -1040,8 +1245,12 @@ static const char terminalParameterNames[] PROGMEM = {
 };
 
 #endif // defined(useDebugTerminalLabels)
-// 0byyy0 0000 - MPGuino parameter action needed that is critical to measurements of fuel injection, VSS, timeouts, and the like
-// 0b0000 0xxx - fractional part of parameter size in bits
+// parameter descriptor layout - a single PROGMEM long word read yields everything needed to access a parameter
+//
+// 0xE0000000 - MPGuino parameter action needed that is critical to measurements of fuel injection, VSS, timeouts, and the like
+// 0x1F000000 - groups of derived values that depend on the parameter, which get recomputed whenever the parameter changes
+// 0x00FF0000 - parameter size in bits
+// 0x0000FFFF - parameter EEPROM address
 
 static const uint8_t pfDoNothing =				0;
 static const uint8_t pfSoftwareInitMPGuino =	pfDoNothing + 32;
@@ -1050,282 +1259,167 @@ static const uint8_t pfDoMetricModeConversion =	pfHardwareInitMPGuino + 32;
 static const uint8_t pfChangeDisplay =			pfDoMetricModeConversion + 32;
 static const uint8_t pfCalculateFuelParams =	pfChangeDisplay + 32;
 
-static const uint8_t paramsLength[(uint16_t)(eePtrStorageEnd)] PROGMEM = {
-	 (pSizeSignature & 0x07) | pfHardwareInitMPGuino							// EEPROM MPGuino signature long word
-	,(pSizeMetricMode & 0x07) | pfDoMetricModeConversion						// Display Mode (0 - US Display, 1 - Metric Display)
-	,(pSizeAlternateFE & 0x07) | pfChangeDisplay								// 0 - MPG or L/100km, 1 - G/100mile or km/L
-	,(pSizeMicroSecondsPerGallon & 0x07) | pfSoftwareInitMPGuino				// Microseconds per US gallon
-	,(pSizeInjEdgeTrigger & 0x07) | pfHardwareInitMPGuino						// Fuel Injector Edge Trigger (0 - Falling Edge, 1 - Rising Edge)
-	,(pSizeInjectorSettleTime & 0x07) | pfSoftwareInitMPGuino					// Fuel Injector Opening Delay Time (us)
-	,(pSizeInjPer2CrankRev & 0x07) | pfSoftwareInitMPGuino					// Crankshaft Revolutions per Fuel Injector Event
-	,(pSizeMinGoodRPM & 0x07) | pfSoftwareInitMPGuino							// Minimum Engine Speed For Engine On (RPM)
-	,(pSizePulsesPerDistance & 0x07) | pfSoftwareInitMPGuino					// VSS Pulses (per mile or per km)
-	,(pSizeVSSpause & 0x07) | pfHardwareInitMPGuino								// VSS Pause Debounce Count (ms)
-	,(pSizeMinGoodSpeed & 0x07) | pfSoftwareInitMPGuino							// Minimum Vehicle Speed for Vehicle in Motion (MPH or kph) * 1000
-	,(pSizeTankSize & 0x07) | pfSoftwareInitMPGuino								// Tank Capacity * 1000 (gal or L)
-	,(pSizeTankBingoSize & 0x07) | pfSoftwareInitMPGuino						// Bingo Fuel (reserve tank) Capacity * 1000 (gal or L)
-	,(pSizeIdleTimeout & 0x07) | pfSoftwareInitMPGuino							// Engine Idle Timeout (s)
-	,(pSizeEOCtimeout & 0x07) | pfSoftwareInitMPGuino							// Engine-Off Coasting Timeout (s)
-	,(pSizeButtonTimeout & 0x07) | pfSoftwareInitMPGuino						// Button Press Activity Timeout (s)
-	,(pSizeParkTimeout & 0x07) | pfSoftwareInitMPGuino							// Vehicle Parked (engine off, no movement) Timeout (s)
-	,(pSizeActivityTimeout & 0x07) | pfSoftwareInitMPGuino						// Activity (engine off, no movement, no button press) Timeout (s)
-	,(pSizeScratchpad & 0x07)													// Scratchpad Memory
-#if defined(useButtonInput)
-	,(pSizeWakeupResetCurrentOnEngine & 0x07)									// Enable current trip reset upon wakeup due to engine running
-	,(pSizeWakeupResetCurrentOnMove & 0x07)										// Enable current trip reset upon wakeup due to vehicle movement
-#endif // defined(useButtonInput)
-#if defined(useLCDoutput)
-	,(pSizeBrightness & 0x07) | pfChangeDisplay									// LCD Brightness
-#if defined(useLCDcontrast)
-	,(pSizeContrast & 0x07) | pfChangeDisplay									// LCD Contrast
-#endif // defined(useLCDcontrast)
-#if defined(useAdafruitRGBLCDshield)
-	,(pSizeLCDcolor & 0x07) | pfChangeDisplay									// LCD Backlight color
-#endif // defined(useAdafruitRGBLCDshield)
-#endif // defined(useLCDoutput)
-#if defined(useFuelCost)
-	,(pSizeFuelUnitCost & 0x07)													// Price per unit volume of fuel
-#endif // defined(useFuelCost)
-#if defined(useOutputPins)
-	,(pSizeOutputPin1Mode & 0x07)												// Output Pin 1 mode
-	,(pSizeOutputPin2Mode & 0x07)												// Output Pin 2 mode
-#endif // defined(useOutputPins)
-#if defined(useCarVoltageOutput)
-	,(pSizeVoltageOffset & 0x07)												// diode offset from V(alternator)
-#endif // defined(useCarVoltageOutput)
-#if defined(useDataLoggingOutput)
-	,(pSizeSerialDataLogging & 0x07)											// Serial Data Logging Enable
-#endif // defined(useDataLoggingOutput)
-#if defined(useJSONoutput)
-	,(pSizeJSONoutput & 0x07)													// JSON output Enable
-#endif // defined(useJSONoutput)
-#if defined(useBarFuelEconVsTime)
-	,(pSizeFEvsTime & 0x07) | pfSoftwareInitMPGuino								// Period Of FE over Time BarGraph Bar (s)
-#endif // defined(useBarFuelEconVsTime)
-#if defined(useBarFuelEconVsSpeed)
-	,(pSizeBarLowSpeedCutoff & 0x07) | pfSoftwareInitMPGuino					// FE vs Speed Bargraph lower speed
-	,(pSizeBarSpeedQuantumIdx & 0x07) | pfSoftwareInitMPGuino					// FE vs Speed Bargraph speed bar size
-#endif // defined(useBarFuelEconVsSpeed)
-#if defined(useFuelPressure)
-	,(pSizeSysFuelPressure & 0x07) | pfSoftwareInitMPGuino						// Fuel System Pressure (Pa or * 1000 psig)
-#endif // defined(useFuelPressure)
-#ifdef useCalculatedFuelFactor
-	,(pSizeRefFuelPressure & 0x07) | pfCalculateFuelParams						// Reference Fuel Injector Rated Pressure (Pa or * 1000 psig)
-	,(pSizeInjectorCount & 0x07) | pfCalculateFuelParams						// Fuel Injector Count
-	,(pSizeInjectorSize & 0x07) | pfCalculateFuelParams							// Fuel Injector Rated Capacity in cc/min * 1000 at Reference Fuel Injector Rated Pressure
-#endif // useCalculatedFuelFactor
-#if defined(useChryslerMAPCorrection)
-	,(pSizeMAPsensorFloor & 0x07) | pfSoftwareInitMPGuino						// MAP Sensor Floor * 1000 (V)
-	,(pSizeMAPsensorCeiling & 0x07) | pfSoftwareInitMPGuino						// MAP Sensor Ceiling * 1000 (V)
-	,(pSizeMAPsensorRange & 0x07) | pfSoftwareInitMPGuino						// MAP Sensor Range (Pa or * 1000 psig)
-	,(pSizeMAPsensorOffset & 0x07) | pfSoftwareInitMPGuino						// MAP Sensor Offset (Pa or * 1000 psia)
-#if defined(useChryslerBaroSensor)
-	,(pSizeBaroSensorFloor & 0x07) | pfSoftwareInitMPGuino						// Barometric Sensor Floor * 1000 (V)
-	,(pSizeBaroSensorCeiling & 0x07) | pfSoftwareInitMPGuino					// Barometric Sensor Ceiling * 1000 (V)
-	,(pSizeBaroSensorRange & 0x07) | pfSoftwareInitMPGuino						// Barometric Sensor Range (Pa or * 1000 psig)
-	,(pSizeBaroSensorOffset & 0x07) | pfSoftwareInitMPGuino						// Barometric Sensor Offset (Pa or * 1000 psia)
-#else // defined(useChryslerBaroSensor)
-	,(pSizeBarometricPressure & 0x07) | pfSoftwareInitMPGuino					// Reference Barometric Pressure
-#endif // defined(useChryslerBaroSensor)
-#endif // defined(useChryslerMAPCorrection)
-#if defined(useVehicleParameters)
-	,(pSizeVehicleMass & 0x07)													// Vehicle Weight/Mass (lbs or kg)
-#if defined(useCoastDownCalculator)
-	,(pSizeVehicleFrontalArea & 0x07)											// Vehicle Frontal Area * 1000 (ft^2 or m^2)
-	,(pSizeLocustDensity & 0x07)												// Air density (lb/yd^3 or kg/m^3)
-	,(pSizeCoefficientD & 0x07)													// Vehicle C(d) * 1000
-	,(pSizeCoefficientV & 0x07)													// Vehicle C(v) * 1000
-	,(pSizeCoefficientRR & 0x07)												// Vehicle C(rr) * 1000
-	,(pSizeCoastdownSamplePeriod & 0x07)										// Sample Period in seconds
-#endif // defined(useCoastDownCalculator)
-#if defined(useDragRaceFunction)
-	,(pSizeDragSpeed & 0x07)													// Drag speed cutoff (MPH or kph) * 1000
-	,(pSizeDragDistance & 0x07)													// Drag distance cutoff (miles or km) * 1000
-	,(pSizeDragAutoFlag & 0x07)													// Drag automatic retrigger on vehicle stop
-#endif // defined(useDragRaceFunction)
-#endif // defined(useVehicleParameters)
-#if defined(useSavedTrips)
-	,(pSizeAutoSaveActive & 0x07)												// Autosave Active Trip Data Enable
-#endif // defined(useSavedTrips)
-#if defined(usePartialRefuel)
-	,(pSizeRefuelSize & 0x07) | pfSoftwareInitMPGuino							// Partial Refuel amount * 1000 (gal or L)
-#endif // defined(usePartialRefuel)
-
-#if defined(useButtonInput)
-	,(pSizeDisplayIdx & 0x07) | pfChangeDisplay									// current display index
-#if LCDcharHeight == 4
-	,(pSizeBottomDisplayIdx & 0x07) | pfChangeDisplay							// bottom display index
-	,(pSizeBottomCursorIdx & 0x07)												// bottom display cursor position
-#endif // LCDcharHeight == 4
-#endif // defined(useButtonInput)
-#if defined(useEEPROMtripStorage)
-#if defined(usePartialRefuel)
-	,(pSizeRefuelSaveSizeIdx & 0x07)											// Partial Refuel save amount * 1000 (gal or L)
-#endif // defined(usePartialRefuel)
-	,(pSizeCurrTripSignatureIdx & 0x07)											// Current Trip signature byte
-	,(pSizeTankTripSignatureIdx & 0x07)											// Tank Trip signature byte
-	,(pSizeCurrTripVSSpulseIdx & 0x07)											// Current Trip VSS pulse count storage
-	,(pSizeCurrTripVSScycleIdx & 0x07)											// Current Trip VSS cycle accumulator storage
-	,(pSizeCurrTripInjPulseIdx & 0x07)											// Current Trip injector pulse count storage
-	,(pSizeCurrTripInjCycleIdx & 0x07)											// Current Trip injector open cycle accumulator storage
-	,(pSizeCurrTripEngCycleIdx & 0x07)											// Current Trip engine revolution cycle accumulator storage
-	,(pSizeTankTripVSSpulseIdx & 0x07)											// Tank Trip VSS pulse count storage
-	,(pSizeTankTripVSScycleIdx & 0x07)											// Tank Trip VSS cycle accumulator storage
-	,(pSizeTankTripInjPulseIdx & 0x07)											// Tank Trip injector pulse count storage
-	,(pSizeTankTripInjCycleIdx & 0x07)											// Tank Trip injector open cycle accumulator storage
-	,(pSizeTankTripEngCycleIdx & 0x07)											// Tank Trip engine revolution cycle accumulator storage
-#if defined(trackIdleEOCdata)
-	,(pSizeCurrIEOCvssPulseIdx & 0x07)											// Current Idle/EOC Trip VSS pulse count storage
-	,(pSizeCurrIEOCvssCycleIdx & 0x07)											// Current Idle/EOC Trip VSS cycle accumulator storage
-	,(pSizeCurrIEOCinjPulseIdx & 0x07)											// Current Idle/EOC Trip injector pulse count storage
-	,(pSizeCurrIEOCinjCycleIdx & 0x07)											// Current Idle/EOC Trip injector open cycle accumulator storage
-	,(pSizeCurrIEOCengCycleIdx & 0x07)											// Current Idle/EOC Trip engine revolution cycle accumulator storage
-	,(pSizeTankIEOCvssPulseIdx & 0x07)											// Tank Idle/EOC Trip VSS pulse count storage
-	,(pSizeTankIEOCvssCycleIdx & 0x07)											// Tank Idle/EOC Trip VSS cycle accumulator storage
-	,(pSizeTankIEOCinjPulseIdx & 0x07)											// Tank Idle/EOC Trip injector pulse count storage
-	,(pSizeTankIEOCinjCycleIdx & 0x07)											// Tank Idle/EOC Trip injector open cycle accumulator storage
-	,(pSizeTankIEOCengCycleIdx & 0x07)											// Tank Idle/EOC Trip engine revolution cycle accumulator storage
-#endif // defined(trackIdleEOCdata)
-#endif // defined(useEEPROMtripStorage)
-};
-
-/* parameter EEPROM addresses for parameter definitions above */
-
-static const uint16_t paramAddrs[(uint16_t)(eePtrStorageEnd)] PROGMEM = {
-	 pAddressSignature					// EEPROM signature long word for MPGuino
-	,pAddressMetricMode					// Display Mode (0 - US Display, 1 - Metric Display)
-	,pAddressAlternateFE				// 0 - MPG or L/100km, 1 - G/100mile or km/L
-	,pAddressMicroSecondsPerGallon		// Microseconds per US gallon
-	,pAddressInjEdgeTrigger				// Fuel Injector Edge Trigger (0 - Falling Edge, 1 - Rising Edge)
-	,pAddressInjectorSettleTime			// Fuel Injector Opening Delay Time (us)
-	,pAddressInjPer2CrankRev			// Fuel Injector Event Count for every 2 Crankshaft Revolutions
-	,pAddressMinGoodRPM					// Minimum Engine Speed For Engine On (RPM)
-	,pAddressPulsesPerDistance			// VSS Pulses (per mile or per km)
-	,pAddressVSSpause					// VSS Pause Debounce Count (ms)
-	,pAddressMinGoodSpeed				// Minimum Vehicle Speed for Vehicle in Motion (MPH or kph) * 1000
-	,pAddressTankSize					// Tank Capacity * 1000 (gal or L)
-	,pAddressTankBingoSize				// Bingo Fuel (Reserve Fuel) Capacity * 1000 (gal or L)
-	,pAddressIdleTimeout				// Engine Idle Timeout (s)
-	,pAddressEOCtimeout					// Engine-Off Coasting Timeout (s)
-	,pAddressButtonTimeout				// Button Press Activity Timeout (s)
-	,pAddressParkTimeout				// Vehicle Parked (engine off, no movement) Timeout (s)
-	,pAddressActivityTimeout			// Activity (engine off, no movement, no button press) Timeout (s)
-	,pAddressScratchpad					// Scratchpad Memory
+static const uint8_t dvTimeouts =				0b00000001;	// timeouts and periods in timer0 ticks
+static const uint8_t dvVehicleSpeed =			0b00000010;	// VSS based thresholds
+static const uint8_t dvEngineSpeed =			0b00000100;	// engine speed and fuel injector based thresholds
+static const uint8_t dvFuelQuantity =			0b00001000;	// fuel quantities in fuel injector open cycles
+static const uint8_t dvPressure =				0b00010000;	// Chrysler MAP correction pressure terms
+
+static const uint8_t dvAll =					0b00011111;
+
+// anything that writes parameters outside of parameterEdit::onEEPROMchange() has to recompute derived values itself
+static uint8_t derivedValueFlags; // derived value groups waiting to be recomputed
+
+#define paramDescriptor(adr, bitLength, flags) (((uint32_t)(flags) << 24) | ((uint32_t)(bitLength) << 16) | (uint32_t)(adr))
+
+static const uint32_t paramDescriptors[(uint16_t)(eePtrStorageEnd)] PROGMEM = {
+	 paramDescriptor(pAddressSignature, pSizeSignature, pfHardwareInitMPGuino)						// EEPROM MPGuino signature long word
+	,paramDescriptor(pAddressMetricMode, pSizeMetricMode, pfDoMetricModeConversion)					// Display Mode (0 - US Display, 1 - Metric Display)
+	,paramDescriptor(pAddressAlternateFE, pSizeAlternateFE, pfChangeDisplay)						// 0 - MPG or L/100km, 1 - G/100mile or km/L
+	,paramDescriptor(pAddressMicroSecondsPerGallon, pSizeMicroSecondsPerGallon, pfDoNothing | dvFuelQuantity)	// Microseconds per US gallon
+	,paramDescriptor(pAddressInjEdgeTrigger, pSizeInjEdgeTrigger, pfHardwareInitMPGuino)			// Fuel Injector Edge Trigger (0 - Falling Edge, 1 - Rising Edge)
+	,paramDescriptor(pAddressInjectorSettleTime, pSizeInjectorSettleTime, pfDoNothing | dvEngineSpeed)	// Fuel Injector Opening Delay Time (us)
+	,paramDescriptor(pAddressInjPer2CrankRev, pSizeInjPer2CrankRev, pfDoNothing | dvEngineSpeed)	// Crankshaft Revolutions per Fuel Injector Event
+	,paramDescriptor(pAddressMinGoodRPM, pSizeMinGoodRPM, pfDoNothing | dvEngineSpeed)				// Minimum Engine Speed For Engine On (RPM)
+	,paramDescriptor(pAddressPulsesPerDistance, pSizePulsesPerDistance, pfDoNothing | dvVehicleSpeed)	// VSS Pulses (per mile or per km)
+	,paramDescriptor(pAddressVSSpause, pSizeVSSpause, pfDoNothing)									// VSS Pause Debounce Count (ms)
+	,paramDescriptor(pAddressMinGoodSpeed, pSizeMinGoodSpeed, pfDoNothing | dvVehicleSpeed)			// Minimum Vehicle Speed for Vehicle in Motion (MPH or kph) * 1000
+	,paramDescriptor(pAddressTankSize, pSizeTankSize, pfDoNothing | dvFuelQuantity)					// Tank Capacity * 1000 (gal or L)
+	,paramDescriptor(pAddressTankBingoSize, pSizeTankBingoSize, pfDoNothing | dvFuelQuantity)		// Bingo Fuel (reserve tank) Capacity * 1000 (gal or L)
+	,paramDescriptor(pAddressIdleTimeout, pSizeIdleTimeout, pfDoNothing | dvTimeouts)				// Engine Idle Timeout (s)
+	,paramDescriptor(pAddressEOCtimeout, pSizeEOCtimeout, pfDoNothing | dvTimeouts)					// Engine-Off Coasting Timeout (s)
+	,paramDescriptor(pAddressButtonTimeout, pSizeButtonTimeout, pfDoNothing | dvTimeouts)			// Button Press Activity Timeout (s)
+	,paramDescriptor(pAddressParkTimeout, pSizeParkTimeout, pfDoNothing | dvTimeouts)				// Vehicle Parked (engine off, no movement) Timeout (s)
+	,paramDescriptor(pAddressActivityTimeout, pSizeActivityTimeout, pfDoNothing | dvTimeouts)		// Activity (engine off, no movement, no button press) Timeout (s)
+	,paramDescriptor(pAddressScratchpad, pSizeScratchpad, pfDoNothing)								// Scratchpad Memory
 #if defined(useButtonInput)
-	,pAddressWakeupResetCurrentOnEngine	// Enable current trip reset upon wakeup due to engine running
-	,pAddressWakeupResetCurrentOnMove	// Enable current trip reset upon wakeup due to vehicle movement
+	,paramDescriptor(pAddressWakeupResetCurrentOnEngine, pSizeWakeupResetCurrentOnEngine, pfDoNothing)	// Enable current trip reset upon wakeup due to engine running
+	,paramDescriptor(pAddressWakeupResetCurrentOnMove, pSizeWakeupResetCurrentOnMove, pfDoNothing)	// Enable current trip reset upon wakeup due to vehicle movement
 #endif // defined(useButtonInput)
 #if defined(useLCDoutput)
-	,pAddressBrightness					// LCD Brightness
+	,paramDescriptor(pAddressBrightness, pSizeBrightness, pfChangeDisplay)							// LCD Brightness
 #if defined(useLCDcontrast)
-	,pAddressContrast					// LCD Contrast
+	,paramDescriptor(pAddressContrast, pSizeContrast, pfChangeDisplay)								// LCD Contrast
 #endif // defined(useLCDcontrast)
 #if defined(useAdafruitRGBLCDshield)
-	,pAddressLCDcolor					// LCD Backlight color
+	,paramDescriptor(pAddressLCDcolor, pSizeLCDcolor, pfChangeDisplay)								// LCD Backlight color
 #endif // defined(useAdafruitRGBLCDshield)
 #endif // defined(useLCDoutput)
 #if defined(useFuelCost)
-	,pAddressFuelUnitCost				// Price per unit volume of fuel
+	,paramDescriptor(pAddressFuelUnitCost, pSizeFuelUnitCost, pfDoNothing)							// Price per unit volume of fuel
 #endif // defined(useFuelCost)
 #if defined(useOutputPins)
-	,pAddressOutputPin1Mode				// Output Pin 1 mode
-	,pAddressOutputPin2Mode				// Output Pin 2 mode
+	,paramDescriptor(pAddressOutputPin1Mode, pSizeOutputPin1Mode, pfDoNothing)						// Output Pin 1 mode
+	,paramDescriptor(pAddressOutputPin2Mode, pSizeOutputPin2Mode, pfDoNothing)						// Output Pin 2 mode
 #endif // defined(useOutputPins)
 #if defined(useCarVoltageOutput)
-	,pAddressVoltageOffset				// diode offset from V(alternator)
+	,paramDescriptor(pAddressVoltageOffset, pSizeVoltageOffset, pfDoNothing)						// diode offset from V(alternator)
 #endif // defined(useCarVoltageOutput)
 #if defined(useDataLoggingOutput)
-	,pAddressSerialDataLogging			// Serial Data Logging Enable
+	,paramDescriptor(pAddressSerialDataLogging, pSizeSerialDataLogging, pfDoNothing)				// Serial Data Logging Enable
 #endif // defined(useDataLoggingOutput)
+#if defined(useDataLogDelta)
+	,paramDescriptor(pAddressDataLogDelta, pSizeDataLogDelta, pfDoNothing)							// Data Logging change threshold (percent, 0 - output every field)
+#endif // defined(useDataLogDelta)
+#if defined(useDataLogFieldList)
+	,paramDescriptor(pAddressDataLogDivider, pSizeDataLogDivider, pfDoNothing)						// Data Logging sample divider (1 - every sample, 2 - every other sample, etc)
+#endif // defined(useDataLogFieldList)
 #if defined(useJSONoutput)
-	,pAddressJSONoutput					// JSON output Enable
+	,paramDescriptor(pAddressJSONoutput, pSizeJSONoutput, pfDoNothing)								// JSON output Enable
 #endif // defined(useJSONoutput)
 #if defined(useBarFuelEconVsTime)
-	,pAddressFEvsTime					// Period Of FE over Time Bar Graph Bar (s)
+	,paramDescriptor(pAddressFEvsTime, pSizeFEvsTime, pfDoNothing | dvTimeouts)						// Period Of FE over Time BarGraph Bar (s)
 #endif // defined(useBarFuelEconVsTime)
 #if defined(useBarFuelEconVsSpeed)
-	,pAddressBarLowSpeedCutoff			// FE vs Speed Bargraph lower speed
-	,pAddressBarSpeedQuantumIdx			// FE vs Speed Bargraph speed bar size
+	,paramDescriptor(pAddressBarLowSpeedCutoff, pSizeBarLowSpeedCutoff, pfDoNothing | dvVehicleSpeed)	// FE vs Speed Bargraph lower speed
+	,paramDescriptor(pAddressBarSpeedQuantumIdx, pSizeBarSpeedQuantumIdx, pfDoNothing | dvVehicleSpeed)	// FE vs Speed Bargraph speed bar size
+	,paramDescriptor(pAddressBarSpeedScale, pSizeBarSpeedScale, pfDoNothing)						// FE vs Speed Bargraph bar edges (0 - linear, 1 - logarithmic)
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useEWMAtripFilter)
+	,paramDescriptor(pAddressEWMAtimeConstant, pSizeEWMAtimeConstant, pfDoNothing)					// Instant FE Filter Time Constant (s)
+#endif // defined(useEWMAtripFilter)
 #if defined(useFuelPressure)
-	,pAddressSysFuelPressure			// Fuel System Pressure (Pa or * 1000 psig)
+	,paramDescriptor(pAddressSysFuelPressure, pSizeSysFuelPressure, pfDoNothing | dvPressure)		// Fuel System Pressure (Pa or * 1000 psig)
 #endif // defined(useFuelPressure)
 #ifdef useCalculatedFuelFactor
-	,pAddressRefFuelPressure			// Reference Fuel Injector Rated Pressure (Pa or * 1000 psig)
-	,pAddressInjectorCount				// Fuel Injector Count
-	,pAddressInjectorSize				// Fuel Injector Rated Capacity in cc/min * 1000 at Reference Fuel Injector Rated Pressure
+	,paramDescriptor(pAddressRefFuelPressure, pSizeRefFuelPressure, pfCalculateFuelParams)			// Reference Fuel Injector Rated Pressure (Pa or * 1000 psig)
+	,paramDescriptor(pAddressInjectorCount, pSizeInjectorCount, pfCalculateFuelParams)				// Fuel Injector Count
+	,paramDescriptor(pAddressInjectorSize, pSizeInjectorSize, pfCalculateFuelParams)				// Fuel Injector Rated Capacity in cc/min * 1000 at Reference Fuel Injector Rated Pressure
 #endif // useCalculatedFuelFactor
 #if defined(useChryslerMAPCorrection)
-	,pAddressMAPsensorFloor				// MAP Sensor Floor * 1000 (V)
-	,pAddressMAPsensorCeiling			// MAP Sensor Ceiling * 1000 (V)
-	,pAddressMAPsensorRange				// MAP Sensor Range (Pa or * 1000 psig)
-	,pAddressMAPsensorOffset			// MAP Sensor Offset (Pa or * 1000 psia)
+	,paramDescriptor(pAddressMAPsensorFloor, pSizeMAPsensorFloor, pfDoNothing | dvPressure)			// MAP Sensor Floor * 1000 (V)
+	,paramDescriptor(pAddressMAPsensorCeiling, pSizeMAPsensorCeiling, pfDoNothing | dvPressure)		// MAP Sensor Ceiling * 1000 (V)
+	,paramDescriptor(pAddressMAPsensorRange, pSizeMAPsensorRange, pfDoNothing | dvPressure)			// MAP Sensor Range (Pa or * 1000 psig)
+	,paramDescriptor(pAddressMAPsensorOffset, pSizeMAPsensorOffset, pfDoNothing | dvPressure)		// MAP Sensor Offset (Pa or * 1000 psia)
 #if defined(useChryslerBaroSensor)
-	,pAddressBaroSensorFloor			// Barometric Sensor Floor * 1000 (V)
-	,pAddressBaroSensorCeiling			// Barometric Sensor Ceiling * 1000 (V)
-	,pAddressBaroSensorRange			// Barometric Sensor Range (Pa or * 1000 psig)
-	,pAddressBaroSensorOffset			// Barometric Sensor Offset (Pa or * 1000 psia)
+	,paramDescriptor(pAddressBaroSensorFloor, pSizeBaroSensorFloor, pfDoNothing | dvPressure)		// Barometric Sensor Floor * 1000 (V)
+	,paramDescriptor(pAddressBaroSensorCeiling, pSizeBaroSensorCeiling, pfDoNothing | dvPressure)	// Barometric Sensor Ceiling * 1000 (V)
+	,paramDescriptor(pAddressBaroSensorRange, pSizeBaroSensorRange, pfDoNothing | dvPressure)		// Barometric Sensor Range (Pa or * 1000 psig)
+	,paramDescriptor(pAddressBaroSensorOffset, pSizeBaroSensorOffset, pfDoNothing | dvPressure)		// Barometric Sensor Offset (Pa or * 1000 psia)
 #else // defined(useChryslerBaroSensor)
-	,pAddressBarometricPressure			// Reference Barometric Pressure
+	,paramDescriptor(pAddressBarometricPressure, pSizeBarometricPressure, pfDoNothing | dvPressure)	// Reference Barometric Pressure
 #endif // defined(useChryslerBaroSensor)
 #endif // defined(useChryslerMAPCorrection)
 #if defined(useVehicleParameters)
-	,pAddressVehicleMass				// Vehicle Weight/Mass (lbs or kg)
+	,paramDescriptor(pAddressVehicleMass, pSizeVehicleMass, pfDoNothing)							// Vehicle Weight/Mass (lbs or kg)
 #if defined(useCoastDownCalculator)
-	,pAddressVehicleFrontalArea			// Vehicle Frontal Area * 1000 (ft^2 or m^2)
-	,pAddressLocustDensity				// Air density (lb/yd^3 or kg/m^3)
-	,pAddressCoefficientD				// Vehicle C(d) * 1000
-	,pAddressCoefficientV				// Vehicle C(v) * 1000
-	,pAddressCoefficientRR				// Vehicle C(rr) * 1000
-	,pAddressCoastdownSamplePeriod		// Sample Period in seconds
+	,paramDescriptor(pAddressVehicleFrontalArea, pSizeVehicleFrontalArea, pfDoNothing)				// Vehicle Frontal Area * 1000 (ft^2 or m^2)
+	,paramDescriptor(pAddressLocustDensity, pSizeLocustDensity, pfDoNothing)						// Air density (lb/yd^3 or kg/m^3)
+	,paramDescriptor(pAddressCoefficientD, pSizeCoefficientD, pfDoNothing)							// Vehicle C(d) * 1000
+	,paramDescriptor(pAddressCoefficientV, pSizeCoefficientV, pfDoNothing)							// Vehicle C(v) * 1000
+	,paramDescriptor(pAddressCoefficientRR, pSizeCoefficientRR, pfDoNothing)						// Vehicle C(rr) * 1000
+	,paramDescriptor(pAddressCoastdownSamplePeriod, pSizeCoastdownSamplePeriod, pfDoNothing | dvTimeouts)	// Sample Period in seconds
 #endif // defined(useCoastDownCalculator)
 #if defined(useDragRaceFunction)
-	,pAddressDragSpeed					// Drag speed cutoff (MPH or kph) * 1000
-	,pAddressDragDistance				// Drag distance cutoff (miles or km) * 1000
-	,pAddressDragAutoFlag				// Drag automatic retrigger on vehicle stop
+	,paramDescriptor(pAddressDragSpeed, pSizeDragSpeed, pfDoNothing | dvVehicleSpeed)				// Drag speed cutoff (MPH or kph) * 1000
+	,paramDescriptor(pAddressDragDistance, pSizeDragDistance, pfDoNothing | dvVehicleSpeed)			// Drag distance cutoff (miles or km) * 1000
+	,paramDescriptor(pAddressDragAutoFlag, pSizeDragAutoFlag, pfDoNothing)							// Drag automatic retrigger on vehicle stop
 #endif // defined(useDragRaceFunction)
 #endif // defined(useVehicleParameters)
 #if defined(useSavedTrips)
-	,pAddressAutoSaveActive				// Autosave Active Trip Data Enable
+	,paramDescriptor(pAddressAutoSaveActive, pSizeAutoSaveActive, pfDoNothing)						// Autosave Active Trip Data Enable
 #endif // defined(useSavedTrips)
+#if defined(useTripJournal)
+	,paramDescriptor(pAddressJournalInterval, pSizeJournalInterval, pfDoNothing)					// Trip Journal Autosave Interval (minutes, 0 - autosave only when parked)
+#endif // defined(useTripJournal)
 #if defined(usePartialRefuel)
-	,pAddressRefuelSize					// Partial Refuel amount * 1000 (gal or L)
+	,paramDescriptor(pAddressRefuelSize, pSizeRefuelSize, pfDoNothing | dvFuelQuantity)				// Partial Refuel amount * 1000 (gal or L)
 #endif // defined(usePartialRefuel)
 
 #if defined(useButtonInput)
-	,pAddressDisplayIdx					// current display index
+	,paramDescriptor(pAddressDisplayIdx, pSizeDisplayIdx, pfChangeDisplay)							// current display index
 #if LCDcharHeight == 4
-	,pAddressBottomDisplayIdx			// bottom display index
-	,pAddressBottomCursorIdx			// bottom display cursor position
+	,paramDescriptor(pAddressBottomDisplayIdx, pSizeBottomDisplayIdx, pfChangeDisplay)				// bottom display index
+	,paramDescriptor(pAddressBottomCursorIdx, pSizeBottomCursorIdx, pfDoNothing)					// bottom display cursor position
 #endif // LCDcharHeight == 4
 #endif // defined(useButtonInput)
 #if defined(useEEPROMtripStorage)
 #if defined(usePartialRefuel)
-	,pAddressRefuelSaveSizeIdx			// Partial Refuel save amount * 1000 (gal or L)
+	,paramDescriptor(pAddressRefuelSaveSizeIdx, pSizeRefuelSaveSizeIdx, pfDoNothing)				// Partial Refuel save amount * 1000 (gal or L)
 #endif // defined(usePartialRefuel)
-	,pAddressCurrTripSignatureIdx		// Current Trip signature byte
-	,pAddressTankTripSignatureIdx		// Tank Trip signature byte
-	,pAddressCurrTripVSSpulseIdx		// Current Trip VSS pulse count storage
-	,pAddressCurrTripVSScycleIdx		// Current Trip VSS cycle accumulator storage
-	,pAddressCurrTripInjPulseIdx		// Current Trip injector pulse count storage
-	,pAddressCurrTripInjCycleIdx		// Current Trip injector open cycle accumulator storage
-	,pAddressCurrTripEngCycleIdx		// Current Trip engine revolution cycle accumulator storage
-	,pAddressTankTripVSSpulseIdx		// Tank Trip VSS pulse count storage
-	,pAddressTankTripVSScycleIdx		// Tank Trip VSS cycle accumulator storage
-	,pAddressTankTripInjPulseIdx		// Tank Trip injector pulse count storage
-	,pAddressTankTripInjCycleIdx		// Tank Trip injector open cycle accumulator storage
-	,pAddressTankTripEngCycleIdx		// Tank Trip engine revolution cycle accumulator storage
+	,paramDescriptor(pAddressCurrTripSignatureIdx, pSizeCurrTripSignatureIdx, pfDoNothing)			// Current Trip signature byte
+	,paramDescriptor(pAddressTankTripSignatureIdx, pSizeTankTripSignatureIdx, pfDoNothing)			// Tank Trip signature byte
+	,paramDescriptor(pAddressCurrTripVSSpulseIdx, pSizeCurrTripVSSpulseIdx, pfDoNothing)			// Current Trip VSS pulse count storage
+	,paramDescriptor(pAddressCurrTripVSScycleIdx, pSizeCurrTripVSScycleIdx, pfDoNothing)			// Current Trip VSS cycle accumulator storage
+	,paramDescriptor(pAddressCurrTripInjPulseIdx, pSizeCurrTripInjPulseIdx, pfDoNothing)			// Current Trip injector pulse count storage
+	,paramDescriptor(pAddressCurrTripInjCycleIdx, pSizeCurrTripInjCycleIdx, pfDoNothing)			// Current Trip injector open cycle accumulator storage
+	,paramDescriptor(pAddressCurrTripEngCycleIdx, pSizeCurrTripEngCycleIdx, pfDoNothing)			// Current Trip engine revolution cycle accumulator storage
+	,paramDescriptor(pAddressTankTripVSSpulseIdx, pSizeTankTripVSSpulseIdx, pfDoNothing)			// Tank Trip VSS pulse count storage
+	,paramDescriptor(pAddressTankTripVSScycleIdx, pSizeTankTripVSScycleIdx, pfDoNothing)			// Tank Trip VSS cycle accumulator storage
+	,paramDescriptor(pAddressTankTripInjPulseIdx, pSizeTankTripInjPulseIdx, pfDoNothing)			// Tank Trip injector pulse count storage
+	,paramDescriptor(pAddressTankTripInjCycleIdx, pSizeTankTripInjCycleIdx, pfDoNothing)			// Tank Trip injector open cycle accumulator storage
+	,paramDescriptor(pAddressTankTripEngCycleIdx, pSizeTankTripEngCycleIdx, pfDoNothing)			// Tank Trip engine revolution cycle accumulator storage
 #if defined(trackIdleEOCdata)
-	,pAddressCurrIEOCvssPulseIdx		// Current Idle/EOC Trip VSS pulse count storage
-	,pAddressCurrIEOCvssCycleIdx		// Current Idle/EOC Trip VSS cycle accumulator storage
-	,pAddressCurrIEOCinjPulseIdx		// Current Idle/EOC Trip injector pulse count storage
-	,pAddressCurrIEOCinjCycleIdx		// Current Idle/EOC Trip injector open cycle accumulator storage
-	,pAddressCurrIEOCengCycleIdx		// Current Idle/EOC Trip engine revolution cycle accumulator storage
-	,pAddressTankIEOCvssPulseIdx		// Tank Idle/EOC Trip VSS pulse count storage
-	,pAddressTankIEOCvssCycleIdx		// Tank Idle/EOC Trip VSS cycle accumulator storage
-	,pAddressTankIEOCinjPulseIdx		// Tank Idle/EOC Trip injector pulse count storage
-	,pAddressTankIEOCinjCycleIdx		// Tank Idle/EOC Trip injector open cycle accumulator storage
-	,pAddressTankIEOCengCycleIdx		// Tank Idle/EOC Trip engine revolution cycle accumulator storage
+	,paramDescriptor(pAddressCurrIEOCvssPulseIdx, pSizeCurrIEOCvssPulseIdx, pfDoNothing)			// Current Idle/EOC Trip VSS pulse count storage
+	,paramDescriptor(pAddressCurrIEOCvssCycleIdx, pSizeCurrIEOCvssCycleIdx, pfDoNothing)			// Current Idle/EOC Trip VSS cycle accumulator storage
+	,paramDescriptor(pAddressCurrIEOCinjPulseIdx, pSizeCurrIEOCinjPulseIdx, pfDoNothing)			// Current Idle/EOC Trip injector pulse count storage
+	,paramDescriptor(pAddressCurrIEOCinjCycleIdx, pSizeCurrIEOCinjCycleIdx, pfDoNothing)			// Current Idle/EOC Trip injector open cycle accumulator storage
+	,paramDescriptor(pAddressCurrIEOCengCycleIdx, pSizeCurrIEOCengCycleIdx, pfDoNothing)			// Current Idle/EOC Trip engine revolution cycle accumulator storage
+	,paramDescriptor(pAddressTankIEOCvssPulseIdx, pSizeTankIEOCvssPulseIdx, pfDoNothing)			// Tank Idle/EOC Trip VSS pulse count storage
+	,paramDescriptor(pAddressTankIEOCvssCycleIdx, pSizeTankIEOCvssCycleIdx, pfDoNothing)			// Tank Idle/EOC Trip VSS cycle accumulator storage
+	,paramDescriptor(pAddressTankIEOCinjPulseIdx, pSizeTankIEOCinjPulseIdx, pfDoNothing)			// Tank Idle/EOC Trip injector pulse count storage
+	,paramDescriptor(pAddressTankIEOCinjCycleIdx, pSizeTankIEOCinjCycleIdx, pfDoNothing)			// Tank Idle/EOC Trip injector open cycle accumulator storage
+	,paramDescriptor(pAddressTankIEOCengCycleIdx, pSizeTankIEOCengCycleIdx, pfDoNothing)			// Tank Idle/EOC Trip engine revolution cycle accumulator storage
 #endif // defined(trackIdleEOCdata)
 #endif // defined(useEEPROMtripStorage)
 };
@@ -1385,6 +1479,12 @@ static const uint32_t params[(uint16_t)(eePtrSettingsEnd)] PROGMEM = {
 #if defined(useDataLoggingOutput)
 	,1					// Serial Data Logging Enable
 #endif // defined(useDataLoggingOutput)
+#if defined(useDataLogDelta)
+	,0					// Data Logging change threshold (percent, 0 - output every field)
+#endif // defined(useDataLogDelta)
+#if defined(useDataLogFieldList)
+	,1					// Data Logging sample divider (1 - every sample, 2 - every other sample, etc)
+#endif // defined(useDataLogFieldList)
 #if defined(useJSONoutput)
 	,1					// JSON output Enable
 #endif // defined(useJSONoutput)
@@ -1394,7 +1494,11 @@ static const uint32_t params[(uint16_t)(eePtrSettingsEnd)] PROGMEM = {
 #if defined(useBarFuelEconVsSpeed)
 	,25000				// FE vs Speed Bargraph lower speed
 	,5000				// FE vs Speed Bargraph speed bar size
+	,0					// FE vs Speed Bargraph bar edges (0 - linear, 1 - logarithmic)
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useEWMAtripFilter)
+	,2					// Instant FE Filter Time Constant (s)
+#endif // defined(useEWMAtripFilter)
 #if defined(useFuelPressure)
 	,43500				// Fuel System Pressure (Pa or * 1000 psig)
 #endif // defined(useFuelPressure)
@@ -1436,6 +1540,9 @@ static const uint32_t params[(uint16_t)(eePtrSettingsEnd)] PROGMEM = {
 #if defined(useSavedTrips)
 	,1					// Autosave Active Trip Data Enable
 #endif // defined(useSavedTrips)
+#if defined(useTripJournal)
+	,10					// Trip Journal Autosave Interval (minutes, 0 - autosave only when parked)
+#endif // defined(useTripJournal)
 #if defined(usePartialRefuel)
 	,0					// Partial Refuel amount * 1000 (gal or L)
 #endif // defined(usePartialRefuel)
@@ -27,7 +27,8 @@ static const uint8_t prgmInitEEPROM[] PROGMEM = {
 	instrDone											// exit to caller
 };
 
-static const uint8_t prgmInitMPGuino[] PROGMEM = {
+// dvTimeouts - convert timeout and period parameters into timer0 ticks
+static const uint8_t prgmInitTimeouts[] PROGMEM = {
 	instrLdRegEEPROM, 0x02, pIdleTimeoutIdx,			// load idle timeout value in seconds
 	instrMul2byConst, idxTicksPerSecond,				// multiply by timer0 ticks / second term
 	instrStRegVolatile, 0x02, vVehicleStopTimeoutIdx,	// store idle timeout value in timer0 ticks
@@ -36,6 +37,35 @@ static const uint8_t prgmInitMPGuino[] PROGMEM = {
 	instrMul2byConst, idxTicksPerSecond,				// multiply by timer0 ticks / second term
 	instrStRegVolatile, 0x02, vEngineOffTimeoutIdx,		// store EOC timeout value in timer0 ticks
 
+	instrLdRegEEPROM, 0x02, pButtonTimeoutIdx,			// load button press timeout stored parameter
+	instrMul2byConst, idxTicksPerSecond,				// multiply by timer0 ticks / second term
+	instrStRegVolatile, 0x02, vButtonTimeoutIdx,		// store button press timeout timer ticks value
+
+	instrLdRegEEPROM, 0x02, pParkTimeoutIdx,			// load parking timeout stored parameter
+	instrMul2byConst, idxTicksPerSecond,				// multiply by timer0 ticks / second term
+	instrStRegVolatile, 0x02, vParkTimeoutIdx,			// store parking timeout timer ticks value
+
+	instrLdRegEEPROM, 0x02, pActivityTimeoutIdx,		// load activity timeout stored parameter
+	instrMul2byConst, idxTicksPerSecond,				// multiply by timer0 ticks / second term
+	instrStRegVolatile, 0x02, vActivityTimeoutIdx,		// store activity timeout timer ticks value
+
+#if defined(useCoastDownCalculator)
+	instrLdRegEEPROM, 0x02, pCoastdownSamplePeriodIdx,	// coastdown timer ticks value
+	instrMul2byConst, idxTicksPerSecond,				// multiply by timer0 ticks / second term
+	instrStRegVolatile, 0x02, vCoastdownPeriodIdx,		// store coastdown timeout timer ticks value
+
+#endif	// defined(useCoastDownCalculator)
+#if defined(useBarFuelEconVsTime)
+	instrLdRegEEPROM, 0x02, pFEvsTimeIdx,				// load fuel econ vs time period stored parameter
+	instrMul2byConst, idxTicksPerSecond,				// multiply by timer0 ticks / second term
+	instrStRegVolatile, 0x02, vFEvsTimePeriodTimeoutIdx,	// store fuel econ vs time period timer ticks value
+
+#endif // defined(useBarFuelEconVsTime)
+	instrDone											// exit to caller
+};
+
+// dvVehicleSpeed - derive VSS period thresholds from speed and distance parameters
+static const uint8_t prgmInitVehicleSpeed[] PROGMEM = {
 	instrLdRegEEPROM, 0x02, pMinGoodSpeedidx,			// fetch minimum good vehicle speed value in (distance)(* 1000) / hour
 	instrMul2byEEPROM, pPulsesPerDistanceIdx,			// multiply by distance parameter value in (VSS pulses) / (distance)
 	instrLdReg, 0x21,									// save denominator term for later
@@ -49,6 +79,46 @@ static const uint8_t prgmInitMPGuino[] PROGMEM = {
 	instrAdjustQuotient,								// bump up quotient by adjustment term (0 if remainder/divisor < 0.5, 1 if remainder/divisor >= 0.5)
 	instrStRegVolatile, 0x02, vDetectVehicleStopIdx,	// store minimum good vehicle speed of timer0 ticks / VSS pulse
 
+#if defined(useBarFuelEconVsSpeed)
+	instrLdRegEEPROM, 0x02, pBarLowSpeedCutoffIdx,		// obtain low-speed cutoff parameter in (distance)(* 1000) / (hour)
+	instrMul2byEEPROM, pPulsesPerDistanceIdx,			// term is now (VSS pulses)(* 1000) / (hour)
+	instrDiv2byConst, idxSecondsPerHour,				// term is now (VSS pulses)(* 1000) / (second)
+	instrAdjustQuotient,								// bump up quotient by adjustment term (0 if remainder/divisor < 0.5, 1 if remainder/divisor >= 0.5)
+	instrStRegMain, 0x02, mpFEvsSpeedMinThresholdIdx,	// store minimum threshold speed in (VSS pulses)(* 1000) / (second)
+
+	instrLdRegEEPROM, 0x02, pBarSpeedQuantumIdx,		// fetch speed quantum parameter in (distance)(* 1000) / hour
+	instrMul2byEEPROM, pPulsesPerDistanceIdx,			// term is now (VSS pulses)(* 1000) / (hour)
+	instrDiv2byConst, idxSecondsPerHour,				// term is now (VSS pulses)(* 1000) / (second)
+	instrAdjustQuotient,								// bump up quotient by adjustment term (0 if remainder/divisor < 0.5, 1 if remainder/divisor >= 0.5)
+	instrStRegMain, 0x02, mpFEvsSpeedQuantumIdx,		// store speed quantum in (VSS pulses)(* 1000) / (second)
+
+#endif // defined(useBarFuelEconVsSpeed)
+#if defined(useDragRaceFunction)
+	instrLdRegEEPROM, 0x02, pDragSpeedIdx,				// load acceleration test full speed parameter in (distance)(* 1000) / (hour)
+	instrMul2byEEPROM, pPulsesPerDistanceIdx,			// term is now (VSS pulse)(* 1000) / (hour)
+	instrLdReg, 0x21,									// save denominator term for later
+	instrLdRegConst, 0x02, idxSecondsPerHour,			// fetch (second) / (hour) constant
+	instrMul2byConst, idxCycles0PerSecond,				// term is now (timer0 cycles) / (hour) term
+	instrMul2byConst, idxDecimalPoint,					// term is now (timer0 cycles)(* 1000) / (hour)
+	instrMul2byByte, 2,									// term is now (timer0 cycles)(* 2000) / (hour)
+	instrDiv2by1,										// perform conversion, term is now in (timer0 cycles)(* 2) / (VSS pulse)
+	instrAdjustQuotient,								// bump up quotient by adjustment term (0 if remainder/divisor < 0.5, 1 if remainder/divisor >= 0.5)
+	instrStRegVolatile, 0x02, vAccelHalfPeriodValueIdx,	// save it to accel test half-speed period tripwire variable
+	instrDiv2byByte, 2,									// term is now (timer0 cycles) / (VSS pulse)
+	instrAdjustQuotient,								// bump up quotient by adjustment term (0 if remainder/divisor < 0.5, 1 if remainder/divisor >= 0.5)
+	instrStRegVolatile, 0x02, vAccelFullPeriodValueIdx,	// save it to accel test full-speed period tripwire variable
+	instrLdRegEEPROM, 0x02, pPulsesPerDistanceIdx,		// fetch drag function distance parameter value in VSS pulses
+	instrMul2byEEPROM, pDragDistanceIdx,				// multiply by drag function distance parameter value in unit distance
+	instrDiv2byConst, idxDecimalPoint,					// get rid of decimal formatting factor
+	instrAdjustQuotient,								// bump up quotient by adjustment term (0 if remainder/divisor < 0.5, 1 if remainder/divisor >= 0.5)
+	instrStRegVolatile, 0x02, vAccelDistanceValueIdx,	// save it to accel test distanct tripwire variable
+
+#endif // defined(useDragRaceFunction)
+	instrDone											// exit to caller
+};
+
+// dvEngineSpeed - derive engine period and fuel injector pulse thresholds
+static const uint8_t prgmInitEngineSpeed[] PROGMEM = {
 	instrLdRegEEPROM, 0x02, pMinGoodRPMidx,				// load minimum good engine speed value in (crank revolutions) / (minute)
 	instrMul2byEEPROM, pInjPer2CrankRevIdx,				// multiply by the number of (injector fire event) / (2)(crank revolutions)
 	instrLdReg, 0x21,									// move denominator (injector fire event) / (2)(minute) to register 1
@@ -62,18 +132,6 @@ static const uint8_t prgmInitMPGuino[] PROGMEM = {
 	instrAdjustQuotient,								// bump up quotient by adjustment term (0 if remainder/divisor < 0.5, 1 if remainder/divisor >= 0.5)
 	instrStRegVolatile, 0x02, vDetectEngineOffIdx,		// store minimum good engine speed value in timer0 ticks / fire event
 
-	instrLdRegEEPROM, 0x02, pButtonTimeoutIdx,			// load button press timeout stored parameter
-	instrMul2byConst, idxTicksPerSecond,				// multiply by timer0 ticks / second term
-	instrStRegVolatile, 0x02, vButtonTimeoutIdx,		// store button press timeout timer ticks value
-
-	instrLdRegEEPROM, 0x02, pParkTimeoutIdx,			// load parking timeout stored parameter
-	instrMul2byConst, idxTicksPerSecond,				// multiply by timer0 ticks / second term
-	instrStRegVolatile, 0x02, vParkTimeoutIdx,			// store parking timeout timer ticks value
-
-	instrLdRegEEPROM, 0x02, pActivityTimeoutIdx,		// load activity timeout stored parameter
-	instrMul2byConst, idxTicksPerSecond,				// multiply by timer0 ticks / second term
-	instrStRegVolatile, 0x02, vActivityTimeoutIdx,		// store activity timeout timer ticks value
-
 	instrLdRegEEPROM, 0x02, pInjectorSettleTimeIdx,		// fetch injector settle time in microseconds
 	instrMul2byConst, idxCycles0PerSecond,				// multiply by timer0 cycles / second term
 	instrDiv2byConst, idxMicroSecondsPerSecond,			// divide by microseconds per seconds value
@@ -82,7 +140,11 @@ static const uint8_t prgmInitMPGuino[] PROGMEM = {
 	instrLdRegVolatile, 0x02, vMaximumEnginePeriodIdx,	// load maximum good engine period value in timer0 cycles / fire event
 	instrSubYfromX, 0x32,								// subtract injector settle time from maximum good engine period
 	instrStRegVolatile, 0x02, vInjectorValidMaxWidthIdx,	// store maximum valid fuel injector pulse width in timer0 cycles
+	instrDone											// exit to caller
+};
 
+// dvFuelQuantity - convert fuel quantity parameters into fuel injector open cycles
+static const uint8_t prgmInitFuelQuantity[] PROGMEM = {
 	instrLdRegEEPROM, 0x02, pMicroSecondsPerGallonIdx,	// fetch injector cycle time in microseconds per US gallon
 #ifdef useImperialGallon
 	instrBranchIfMetricMode, 5,							// if metric mode set, skip ahead to cycles conversion
@@ -124,12 +186,11 @@ static const uint8_t prgmInitMPGuino[] PROGMEM = {
 	instrStRegMain, 0x02, mpPartialRefuelTankSize,		// save partial refuel tank size in cycles
 
 #endif // defined(usePartialRefuel)
-#if defined(useCoastDownCalculator)
-	instrLdRegEEPROM, 0x02, pCoastdownSamplePeriodIdx,	// coastdown timer ticks value
-	instrMul2byConst, idxTicksPerSecond,				// multiply by timer0 ticks / second term
-	instrStRegVolatile, 0x02, vCoastdownPeriodIdx,		// store coastdown timeout timer ticks value
+	instrDone											// exit to caller
+};
 
-#endif	// defined(useCoastDownCalculator)
+// dvPressure - derive Chrysler MAP correction pressure terms
+static const uint8_t prgmInitPressure[] PROGMEM = {
 #if defined(useChryslerMAPCorrection)
 	instrLdRegEEPROM, 0x02, pMAPsensorFloorIdx,			// convert pressure sensor voltage floor to equivalent ADC floor value
 	instrMul2byConst, idxNumerVoltage,
@@ -173,26 +234,19 @@ static const uint8_t prgmInitMPGuino[] PROGMEM = {
 	instrStRegVolatile, 0x02, vInjectorCorrectionIdx,	// save initial injector correction index for pressure differential calculation
 
 #endif	// defined(useChryslerMAPCorrection)
-#if defined(useBarFuelEconVsTime)
-	instrLdRegEEPROM, 0x02, pFEvsTimeIdx,				// load fuel econ vs time period stored parameter
-	instrMul2byConst, idxTicksPerSecond,				// multiply by timer0 ticks / second term
-	instrStRegVolatile, 0x02, vFEvsTimePeriodTimeoutIdx,	// store fuel econ vs time period timer ticks value
-
-#endif // defined(useBarFuelEconVsTime)
-#if defined(useBarFuelEconVsSpeed)
-	instrLdRegEEPROM, 0x02, pBarLowSpeedCutoffIdx,		// obtain low-speed cutoff parameter in (distance)(* 1000) / (hour)
-	instrMul2byEEPROM, pPulsesPerDistanceIdx,			// term is now (VSS pulses)(* 1000) / (hour)
-	instrDiv2byConst, idxSecondsPerHour,				// term is now (VSS pulses)(* 1000) / (second)
-	instrAdjustQuotient,								// bump up quotient by adjustment term (0 if remainder/divisor < 0.5, 1 if remainder/divisor >= 0.5)
-	instrStRegMain, 0x02, mpFEvsSpeedMinThresholdIdx,	// store minimum threshold speed in (VSS pulses)(* 1000) / (second)
+	instrDone											// exit to caller
+};
 
-	instrLdRegEEPROM, 0x02, pBarSpeedQuantumIdx,		// fetch speed quantum parameter in (distance)(* 1000) / hour
-	instrMul2byEEPROM, pPulsesPerDistanceIdx,			// term is now (VSS pulses)(* 1000) / (hour)
-	instrDiv2byConst, idxSecondsPerHour,				// term is now (VSS pulses)(* 1000) / (second)
-	instrAdjustQuotient,								// bump up quotient by adjustment term (0 if remainder/divisor < 0.5, 1 if remainder/divisor >= 0.5)
-	instrStRegMain, 0x02, mpFEvsSpeedQuantumIdx,		// store speed quantum in (VSS pulses)(* 1000) / (second)
+// one derived value program per dv* group, in dv* bit order
+static const uint8_t * const derivedValuePrograms[] PROGMEM = {
+	 prgmInitTimeouts
+	,prgmInitVehicleSpeed
+	,prgmInitEngineSpeed
+	,prgmInitFuelQuantity
+	,prgmInitPressure
+};
 
-#endif // defined(useBarFuelEconVsSpeed)
+static const uint8_t prgmInitMPGuino[] PROGMEM = {
 #if defined(useCPUreading) || defined(useDebugCPUreading)
 	instrLdRegByte, 0x02, 0,
 	instrStRegMain, 0x02, mpMainLoopAccumulatorIdx,		// initialize the cpu utilization stopwatch timer values
@@ -213,28 +267,6 @@ static const uint8_t prgmInitMPGuino[] PROGMEM = {
 	instrStRegMain, 0x02, mpDebugAccS64divIdx,
 	instrStRegMain, 0x02, mpDebugCountS64divIdx,
 #endif // defined(useDebugCPUreading)
-
-#if defined(useDragRaceFunction)
-	instrLdRegEEPROM, 0x02, pDragSpeedIdx,				// load acceleration test full speed parameter in (distance)(* 1000) / (hour)
-	instrMul2byEEPROM, pPulsesPerDistanceIdx,			// term is now (VSS pulse)(* 1000) / (hour)
-	instrLdReg, 0x21,									// save denominator term for later
-	instrLdRegConst, 0x02, idxSecondsPerHour,			// fetch (second) / (hour) constant
-	instrMul2byConst, idxCycles0PerSecond,				// term is now (timer0 cycles) / (hour) term
-	instrMul2byConst, idxDecimalPoint,					// term is now (timer0 cycles)(* 1000) / (hour)
-	instrMul2byByte, 2,									// term is now (timer0 cycles)(* 2000) / (hour)
-	instrDiv2by1,										// perform conversion, term is now in (timer0 cycles)(* 2) / (VSS pulse)
-	instrAdjustQuotient,								// bump up quotient by adjustment term (0 if remainder/divisor < 0.5, 1 if remainder/divisor >= 0.5)
-	instrStRegVolatile, 0x02, vAccelHalfPeriodValueIdx,	// save it to accel test half-speed period tripwire variable
-	instrDiv2byByte, 2,									// term is now (timer0 cycles) / (VSS pulse)
-	instrAdjustQuotient,								// bump up quotient by adjustment term (0 if remainder/divisor < 0.5, 1 if remainder/divisor >= 0.5)
-	instrStRegVolatile, 0x02, vAccelFullPeriodValueIdx,	// save it to accel test full-speed period tripwire variable
-	instrLdRegEEPROM, 0x02, pPulsesPerDistanceIdx,		// fetch drag function distance parameter value in VSS pulses
-	instrMul2byEEPROM, pDragDistanceIdx,				// multiply by drag function distance parameter value in unit distance
-	instrDiv2byConst, idxDecimalPoint,					// get rid of decimal formatting factor
-	instrAdjustQuotient,								// bump up quotient by adjustment term (0 if remainder/divisor < 0.5, 1 if remainder/divisor >= 0.5)
-	instrStRegVolatile, 0x02, vAccelDistanceValueIdx,	// save it to accel test distanct tripwire variable
-
-#endif // defined(useDragRaceFunction)
 	instrDone											// exit to caller
 };
 
@@ -243,6 +275,10 @@ static uint8_t EEPROM::powerUpCheck(void)
 
 	uint8_t b;
 
+#if defined(useEEPROMparameterCache)
+	loadParameterCache(); // everything below reads parameters from RAM
+
+#endif // defined(useEEPROMparameterCache)
 	b = SWEET64::runPrgm(prgmInitEEPROM, 0); // perform EEPROM initialization if required, and cause MPGuino initialization when done
 
 #if defined(useScreenEditor)
@@ -255,6 +291,14 @@ static uint8_t EEPROM::powerUpCheck(void)
 	}
 
 #endif // defined(useScreenEditor)
+#if defined(useDataLogFieldList)
+	if (b) dataLogResetFields(); // go load the default data logging field list
+
+#endif // defined(useDataLogFieldList)
+#if defined(useTripJournal)
+	if (b) tripJournal::erase(); // go invalidate any journaled trips, so that they do not get restored
+
+#endif // defined(useTripJournal)
 	initGuino();
 
 	return b;
@@ -356,6 +400,9 @@ static void EEPROM::initGuinoSoftware(void)
 
 	uint8_t oldSREG;
 
+	// interrupt handlers read several of these values together, like the VSS and fuel injector constants, so keep them
+	//    away until the whole set is consistent again - this holds even with useSeqlockTripAccess, whose sequence count
+	//    only guards trip data written by interrupt handlers
 	oldSREG = SREG; // save interrupt flag status
 	cli(); // disable interrupts
 
@@ -365,7 +412,8 @@ static void EEPROM::initGuinoSoftware(void)
 	if (readByte(pAlternateFEidx)) metricFlag |= (alternateFEmode);
 	else metricFlag &= ~(alternateFEmode);
 
-	SWEET64::runPrgm(prgmInitMPGuino, 0); // calculate multiple MPGuino system values for use within code
+	SWEET64::runPrgm(prgmInitMPGuino, 0); // initialize MPGuino system values that do not depend upon stored parameters
+	recomputeDerivedValues(dvAll); // calculate all MPGuino system values derived from stored parameters
 
 #if defined(useBarFuelEconVsTime)
 	timer0Command |= (t0cResetFEvTime); // reset fuel economy vs time bargraph mechanism
@@ -377,15 +425,104 @@ static void EEPROM::initGuinoSoftware(void)
 	bgFEvsSsupport::reset();
 
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useBarEngineLoad)
+	bgEngineLoad::reset();
+
+#endif // defined(useBarEngineLoad)
 #if defined(useWindowTripFilter)
 	tripSupport::resetWindowFilter();
 
 #endif // defined(useWindowTripFilter)
+#if defined(useEWMAtripFilter)
+	tripSupport::resetEWMAfilter();
+
+#endif // defined(useEWMAtripFilter)
+#if defined(useTripJournal)
+	tripJournal::resetCountdown();
+
+#endif // defined(useTripJournal)
+}
+
+static void EEPROM::recomputeDerivedValues(uint8_t dvFlags) // recalculate only those system values whose source parameters changed
+{
+
+	uint8_t oldSREG;
+	uint8_t dvBit;
+	const uint8_t * const * prgmPtr;
+
+	oldSREG = SREG; // save interrupt flag status
+	cli(); // disable interrupts, so interrupt handlers never see a half-updated set of derived values
+
+	dvBit = dvTimeouts;
+	prgmPtr = derivedValuePrograms;
+
+	while (dvBit & dvAll)
+	{
+
+		if (dvFlags & dvBit) SWEET64::runPrgm((const uint8_t *)(pgm_read_word(prgmPtr)), 0);
+
+		dvBit <<= 1;
+		prgmPtr++;
+
+	}
+
+	derivedValueFlags &= ~(dvFlags);
+
+	SREG = oldSREG; // restore interrupt flag status
+
+}
+
+static void EEPROM::resetDependents(uint8_t parameterIdx) // reset any mechanism that holds state based on a just-changed parameter
+{
+
+	switch (parameterIdx)
+	{
+
+		case pVSSpauseIdx:
+			VSSpause = readByte(pVSSpauseIdx);
+			break;
+
+#if defined(useBarFuelEconVsTime)
+		case pFEvsTimeIdx:
+			heart::changeBitFlags(timer0Command, 0, t0cResetFEvTime); // reset fuel economy vs time bargraph mechanism
+			break;
+
+#endif // defined(useBarFuelEconVsTime)
+#if defined(useBarFuelEconVsSpeed)
+		case pPulsesPerDistanceIdx: // bucket edges are in VSS pulses per second, so they have to be worked out again
+		case pBarLowSpeedCutoffIdx:
+		case pBarSpeedQuantumIdx:
+		case pBarSpeedScaleIdx:
+			bgFEvsSsupport::reset();
+			break;
+
+#endif // defined(useBarFuelEconVsSpeed)
+#if defined(useEWMAtripFilter)
+		case pEWMAtimeConstantIdx:
+			tripSupport::resetEWMAfilter();
+			break;
+
+#endif // defined(useEWMAtripFilter)
+#if defined(useTripJournal)
+		case pJournalIntervalIdx:
+			tripJournal::resetCountdown();
+			break;
+
+#endif // defined(useTripJournal)
+		default:
+			break;
+
+	}
+
 }
 
 static void EEPROM::initGuino(void) // initialize MPGuino base hardware and basic system settings
 {
 
+#if defined(useSeqlockTripAccess)
+	initGuinoHardware(); // masks interrupts by itself while it sets up the sensor interrupts
+	initGuinoSoftware();
+#else // defined(useSeqlockTripAccess)
 	uint8_t oldSREG;
 
 	oldSREG = SREG; // save interrupt flag status
@@ -395,6 +532,7 @@ static void EEPROM::initGuino(void) // initialize MPGuino base hardware and basi
 	initGuinoSoftware();
 
 	SREG = oldSREG; // restore interrupt flag status
+#endif // defined(useSeqlockTripAccess)
 
 }
 
@@ -410,7 +548,7 @@ static void EEPROM::writeByte(uint8_t eePtr, uint8_t value)
 
 }
 
-#if defined(useScreenEditor)
+#if defined(useScreenEditor) || defined(useDataLogFieldList)
 static void EEPROM::writeVal(uint8_t eePtr, uint32_t value)
 {
 
@@ -423,7 +561,7 @@ static void EEPROM::writeVal(uint8_t eePtr, uint32_t value)
 
 }
 
-#endif // defined(useScreenEditor)
+#endif // defined(useScreenEditor) || defined(useDataLogFieldList)
 static uint8_t EEPROM::readByte(uint8_t eePtr)
 {
 
@@ -436,7 +574,7 @@ static uint8_t EEPROM::readByte(uint8_t eePtr)
 
 }
 
-#if defined(useScreenEditor)
+#if defined(useScreenEditor) || defined(useDataLogFieldList)
 static uint16_t EEPROM::readWord(uint8_t eePtr)
 {
 
@@ -449,32 +587,39 @@ static uint16_t EEPROM::readWord(uint8_t eePtr)
 
 }
 
-#endif // defined(useScreenEditor)
+#endif // defined(useScreenEditor) || defined(useDataLogFieldList)
 static void EEPROM::read64(union union_64 * an, uint8_t parameterIdx)
 {
 
-	uint8_t oldSREG;
+	uint32_t d;
 	uint16_t t;
 	uint16_t u;
+	uint8_t l;
 
-	t = getAddress(parameterIdx);
-	u = getAddress(++parameterIdx);
+	d = getDescriptor(parameterIdx);
+	t = (uint16_t)(d);
+	l = (uint8_t)(d >> 16);
+	u = t + byteSize(l);
 
 	SWEET64::init64byt(an, 0);
 
-	oldSREG = SREG; // save interrupt flag status
-	cli(); // disable interrupts
+#if defined(useEEPROMparameterCache)
+	if (u <= eeAdrParameterCacheEnd) // if parameter is shadowed in RAM, there is no need to go to EEPROM
+	{
 
-	for (uint16_t x = t; x < u; x++) an->u8[x - t] = eeprom_read_byte((uint8_t *)(x));
+		for (uint16_t x = t; x < u; x++) an->u8[x - t] = parameterCache[(uint16_t)(x)];
 
-	SREG = oldSREG; // restore interrupt flag status
+	}
+	else
+#endif // defined(useEEPROMparameterCache)
+	for (uint16_t x = t; x < u; x++) an->u8[x - t] = readRawByte(x);
 
 }
 
 static void EEPROM::write64(union union_64 * an, uint8_t parameterIdx)
 {
 
-	uint8_t oldSREG;
+	uint32_t d;
 	uint16_t t;
 	uint16_t u;
 	uint8_t l;
@@ -482,26 +627,42 @@ static void EEPROM::write64(union union_64 * an, uint8_t parameterIdx)
 	uint8_t eByt;
 	uint8_t rByt;
 
-	l = getParameterFlags(parameterIdx);
-	t = getAddress(parameterIdx);
-	u = getAddress(++parameterIdx);
-
-	oldSREG = SREG; // save interrupt flag status
-	cli(); // disable interrupts
+	d = getDescriptor(parameterIdx);
+	t = (uint16_t)(d);
+	l = (uint8_t)(d >> 16);
+	u = t + byteSize(l);
+	l = (uint8_t)(d >> 24);
 
 	b = 0;
 
 	for (uint16_t x = t; x < u; x++)
 	{
 
-		eByt = eeprom_read_byte((uint8_t *)(x));
+#if defined(useEEPROMparameterCache)
+		if (x < eeAdrParameterCacheEnd) eByt = parameterCache[(uint16_t)(x)];
+		else eByt = readRawByte(x);
+#else // defined(useEEPROMparameterCache)
+		eByt = readRawByte(x);
+#endif // defined(useEEPROMparameterCache)
 		rByt = an->u8[x - t];
 		if (eByt != rByt)
 		{
 
 			metricFlag |= (EEPROMbulkChangeFlag);
 			b = 1;
-			eeprom_write_byte((uint8_t *)(x), rByt);
+#if defined(useEEPROMparameterCache)
+			if (x < eeAdrParameterCacheEnd) // update RAM copy, and leave the EEPROM programming for later
+			{
+
+				parameterCache[(uint16_t)(x)] = rByt;
+				parameterCacheDirty[(uint16_t)(x >> 3)] |= (1 << (x & 0x07));
+				parameterCacheDirtyFlag = 1;
+
+			}
+			else writeRawByte(x, rByt);
+#else // defined(useEEPROMparameterCache)
+			writeRawByte(x, rByt);
+#endif // defined(useEEPROMparameterCache)
 
 		}
 
@@ -510,6 +671,8 @@ static void EEPROM::write64(union union_64 * an, uint8_t parameterIdx)
 	if (b)
 	{
 
+		derivedValueFlags |= (l & dvAll); // mark the derived value groups that depend upon this parameter
+
 		switch (l & 0xE0)
 		{
 
@@ -537,64 +700,532 @@ static void EEPROM::write64(union union_64 * an, uint8_t parameterIdx)
 
 	}
 
+}
+
+#if defined(useEEPROMwriteQueue)
+ISR( EE_READY_vect ) // called whenever EEPROM is ready to program another byte
+{
+
+#if defined(useDebugCPUreading)
+	uint8_t a;
+	uint8_t b;
+	uint16_t c;
+
+	a = TCNT0; // do a microSeconds() - like read to determine interrupt length in cycles
+
+#endif // defined(useDebugCPUreading)
+	EEPROM::programQueuedByte();
+
+#if defined(useDebugCPUreading)
+	b = TCNT0; // do a microSeconds() - like read to determine interrupt length in cycles
+
+	if (b < a) c = 256 - a + b; // an overflow occurred
+	else c = b - a;
+
+	volatileVariables[(uint16_t)(vInterruptAccumulatorIdx)] += c;
+
+#endif // defined(useDebugCPUreading)
+}
+
+// starts programming the oldest queued byte that differs from what EEPROM already holds
+//
+// must be called with interrupts disabled, and only while EEPROM is not busy
+static void EEPROM::programQueuedByte(void)
+{
+
+	uint8_t i;
+
+	while (eeWriteQueueTail != eeWriteQueueHead)
+	{
+
+		i = eeWriteQueueTail;
+
+		EEAR = eeWriteQueueAddress[(uint16_t)(i)];
+		EECR |= (1 << EERE); // read what EEPROM holds at this address
+
+		eeWriteQueueTail = (i + 1) & eeWriteQueueMask;
+
+		if (EEDR != eeWriteQueueData[(uint16_t)(i)])
+		{
+
+			EEDR = eeWriteQueueData[(uint16_t)(i)];
+			EECR |= (1 << EEMPE);
+			EECR |= (1 << EEPE); // must happen within 4 cycles of setting EEMPE
+
+			return;
+
+		}
+
+	}
+
+	EECR &= ~(1 << EERIE); // queue is empty, so disable EEPROM ready interrupt
+
+}
+
+static uint8_t EEPROM::readRawByte(uint16_t address)
+{
+
+	uint8_t oldSREG;
+	uint8_t i;
+	uint8_t b;
+
+	oldSREG = SREG; // save interrupt flag status
+	cli(); // disable interrupts to keep the interrupt handler away from the queue and from the EEPROM registers
+
+	// a byte still in the queue is newer than what EEPROM holds, and the most recently queued byte is newest of all
+	for (i = eeWriteQueueHead; i != eeWriteQueueTail; )
+	{
+
+		i = (i - 1) & eeWriteQueueMask;
+
+		if (eeWriteQueueAddress[(uint16_t)(i)] == address)
+		{
+
+			b = eeWriteQueueData[(uint16_t)(i)];
+			SREG = oldSREG; // restore interrupt flag status
+
+			return b;
+
+		}
+
+	}
+
+	while (EECR & (1 << EEPE)) // let interrupts in while waiting for EEPROM to finish programming a byte
+	{
+
+		SREG = oldSREG; // restore interrupt flag status
+		eeprom_busy_wait();
+		cli(); // the interrupt handler might have started programming another byte in the meantime, so check again
+
+	}
+
+	EEAR = address;
+	EECR |= (1 << EERE);
+	b = EEDR;
+
 	SREG = oldSREG; // restore interrupt flag status
 
+	return b;
+
 }
 
-static uint16_t EEPROM::getAddress(uint8_t eePtr)
+// adds a byte to the EEPROM write queue, waiting for room if the queue is full
+static void EEPROM::writeRawByte(uint16_t address, uint8_t value)
 {
 
-	uint16_t t;
+	uint8_t oldSREG;
+	uint8_t i;
+
+	i = (eeWriteQueueHead + 1) & eeWriteQueueMask;
+
+	while (i == eeWriteQueueTail) // if the queue is full
+	{
+
+		if ((SREG & (1 << SREG_I)) == 0) // if interrupts are disabled, the interrupt handler will never make room, so go do its job here
+		{
+
+			eeprom_busy_wait();
+			programQueuedByte();
+
+		}
+
+	}
+
+	eeWriteQueueAddress[(uint16_t)(eeWriteQueueHead)] = address;
+	eeWriteQueueData[(uint16_t)(eeWriteQueueHead)] = value;
+
+	oldSREG = SREG; // save interrupt flag status
+	cli(); // disable interrupts
+
+	eeWriteQueueHead = i;
+	EECR |= (1 << EERIE); // enable EEPROM ready interrupt, which will fire right away if EEPROM is idle
+
+	SREG = oldSREG; // restore interrupt flag status
+
+}
+
+static uint8_t EEPROM::isWriteReady(void)
+{
+
+	return (((eeWriteQueueHead + 1) & eeWriteQueueMask) != eeWriteQueueTail);
+
+}
+
+#else // defined(useEEPROMwriteQueue)
+static uint8_t EEPROM::readRawByte(uint16_t address)
+{
+
+	return eeprom_read_byte((uint8_t *)(address));
+
+}
+
+static void EEPROM::writeRawByte(uint16_t address, uint8_t value)
+{
+
+	uint8_t oldSREG;
+
+	eeprom_busy_wait(); // wait for any previous byte to finish programming, with interrupts still enabled
+
+	oldSREG = SREG; // save interrupt flag status
+	cli(); // disable interrupts
+
+	eeprom_write_byte((uint8_t *)(address), value);
+
+	SREG = oldSREG; // restore interrupt flag status
+
+}
+
+static uint8_t EEPROM::isWriteReady(void)
+{
+
+	return eeprom_is_ready();
+
+}
+
+#endif // defined(useEEPROMwriteQueue)
+// waits until every pending parameter and EEPROM write has been programmed into EEPROM
+//
+// call this before anything that could stop EEPROM programming, like power-down sleep
+static void EEPROM::flush(void)
+{
+
+#if defined(useEEPROMparameterCache)
+	flushParameterCache();
+
+#endif // defined(useEEPROMparameterCache)
+#if defined(useEEPROMwriteQueue)
+	while (eeWriteQueueTail != eeWriteQueueHead)
+	{
+
+		if ((SREG & (1 << SREG_I)) == 0) // if interrupts are disabled, go do the interrupt handler's job here
+		{
+
+			eeprom_busy_wait();
+			programQueuedByte();
+
+		}
+
+	}
+
+#endif // defined(useEEPROMwriteQueue)
+	eeprom_busy_wait(); // wait for the last byte to finish programming
+
+}
+
+#if defined(useEEPROMparameterCache)
+static void EEPROM::loadParameterCache(void)
+{
+
+#if defined(useSeqlockTripAccess)
+	// read one byte at a time, so interrupts are only ever held off for a single EEPROM byte read
+	for (uint16_t x = 0; x < eeAdrParameterCacheEnd; x++) parameterCache[(uint16_t)(x)] = readRawByte(x);
+#else // defined(useSeqlockTripAccess)
+	uint8_t oldSREG;
+
+	oldSREG = SREG; // save interrupt flag status
+	cli(); // disable interrupts
+
+	for (uint16_t x = 0; x < eeAdrParameterCacheEnd; x++) parameterCache[(uint16_t)(x)] = eeprom_read_byte((uint8_t *)(x));
+
+	SREG = oldSREG; // restore interrupt flag status
+#endif // defined(useSeqlockTripAccess)
+
+	for (uint16_t x = 0; x < (eeAdrParameterCacheEnd + 7) / 8; x++) parameterCacheDirty[(uint16_t)(x)] = 0;
+
+	parameterCacheWriteAdr = 0;
+	parameterCacheDirtyFlag = 0;
+
+}
+
+// programs at most one dirty parameter byte into EEPROM, and only if EEPROM (or the EEPROM write queue) is ready to take it
+//
+// called once per main loop pass, so the main loop never waits the ~3.3 ms it takes for the EEPROM to program a byte
+static void EEPROM::writeBackProcess(void)
+{
+
+	uint16_t x;
+
+	if ((parameterCacheDirtyFlag) && (isWriteReady()))
+	{
+
+		x = parameterCacheWriteAdr;
+
+		do
+		{
+
+			if (parameterCacheDirty[(uint16_t)(x >> 3)] & (1 << (x & 0x07))) // if this byte was changed, go write it out
+			{
+
+				parameterCacheDirty[(uint16_t)(x >> 3)] &= ~(1 << (x & 0x07));
+
+				writeRawByte(x, parameterCache[(uint16_t)(x)]);
 
-	if (eePtr >= eePtrEnd) eePtr = eePtrEnd;
+				parameterCacheWriteAdr = x;
 
-	if (eePtr < eePtrStorageEnd) t = pgm_read_word(&paramAddrs[eePtr]);
+				return;
+
+			}
+
+			x++;
+			if (x >= eeAdrParameterCacheEnd) x = 0;
+
+		}
+		while (x != parameterCacheWriteAdr);
+
+		parameterCacheDirtyFlag = 0; // no more dirty bytes were found
+
+	}
+
+}
+
+// writes out every dirty parameter byte, waiting on the EEPROM as required
+static void EEPROM::flushParameterCache(void)
+{
+
+	while (parameterCacheDirtyFlag)
+	{
+
+#if defined(useEEPROMwriteQueue)
+		// if the queue is full and interrupts are disabled, the interrupt handler will never make room, so go do its job here
+		if ((isWriteReady() == 0) && ((SREG & (1 << SREG_I)) == 0))
+		{
+
+			eeprom_busy_wait();
+			programQueuedByte();
+
+		}
+
+#endif // defined(useEEPROMwriteQueue)
+		writeBackProcess();
+
+	}
+
+}
+
+#endif // defined(useEEPROMparameterCache)
+static uint32_t EEPROM::getDescriptor(uint8_t eePtr)
+{
+
+	uint32_t t;
+
+	if (eePtr < eePtrStorageEnd) t = pgm_read_dword(&paramDescriptors[(uint16_t)(eePtr)]);
 #if defined(useScreenEditor)
-	else if ((eePtr >= eePtrDisplayPagesStart) && (eePtr < eePtrDisplayPagesEnd)) t = eeAdrScreensStart + 2 * (eePtr - eePtrDisplayPagesStart);
+	else if ((eePtr >= eePtrDisplayPagesStart) && (eePtr < eePtrDisplayPagesEnd)) t = paramDescriptor(eeAdrScreensStart + 2 * (eePtr - eePtrDisplayPagesStart), 16, pfDoNothing);
 #endif // defined(useScreenEditor)
+#if defined(useDataLogFieldList)
+	else if ((eePtr >= eePtrDataLogFieldsStart) && (eePtr < eePtrDataLogFieldsEnd)) t = paramDescriptor(eeAdrDataLogFieldsStart + 2 * (eePtr - eePtrDataLogFieldsStart), 16, pfDoNothing);
+#endif // defined(useDataLogFieldList)
 #if defined(useButtonInput)
-	else if ((eePtr >= eePtrDisplayCursorStart) && (eePtr < eePtrDisplayCursorEnd)) t = eeAdrDisplayCursorStart + (eePtr - eePtrDisplayCursorStart);
-	else if ((eePtr >= eePtrMenuHeightStart) && (eePtr < eePtrMenuHeightEnd)) t = eeAdrMenuCursorStart + (eePtr - eePtrMenuHeightStart);
+	else if ((eePtr >= eePtrDisplayCursorStart) && (eePtr < eePtrDisplayCursorEnd)) t = paramDescriptor(eeAdrDisplayCursorStart + (eePtr - eePtrDisplayCursorStart), 8, pfDoNothing);
+	else if ((eePtr >= eePtrMenuHeightStart) && (eePtr < eePtrMenuHeightEnd)) t = paramDescriptor(eeAdrMenuCursorStart + (eePtr - eePtrMenuHeightStart), 8, pfDoNothing);
 #endif // defined(useButtonInput)
-	else t = eeAdrStorageEnd;
+	else t = paramDescriptor(eeAdrStorageEnd, 0, pfDoNothing);
 
 	return t;
 
 }
 
-static uint8_t EEPROM::getParameterFlags(uint8_t eePtr)
+static uint16_t EEPROM::getAddress(uint8_t eePtr)
 {
 
-	uint8_t t;
+	return (uint16_t)(getDescriptor(eePtr));
 
-	if (eePtr >= eePtrEnd) eePtr = eePtrEnd;
+}
 
-	if (eePtr < eePtrStorageEnd) t = pgm_read_byte(&paramsLength[(uint16_t)(eePtr)]) & 0xF8;
-	else t = 0;
+static uint8_t EEPROM::getParameterFlags(uint8_t eePtr)
+{
 
-	return t;
+	return (uint8_t)(getDescriptor(eePtr) >> 24);
 
 }
 
 static uint8_t EEPROM::getLength(uint8_t eePtr)
 {
 
-	uint8_t t;
-	uint8_t u;
-	uint8_t l;
+	return (uint8_t)(getDescriptor(eePtr) >> 16);
+
+}
+
+#if defined(useParameterTransfer)
+/* settings parameter block bulk import/export section */
+
+static void paramTransfer::exportFrame(interfaceDevice &dev)
+{
 
-	if (eePtr >= eePtrEnd) eePtr = eePtrEnd;
+	uint16_t crc;
+	uint8_t b;
+
+	crc = 0xFFFF;
+
+	text::charOut(dev, '{');
+
+	for (uint16_t x = eeAdrSignature; x < eeAdrParametersEnd; x++)
+	{
+
+		if ((x & 0x1F) == 0) text::newLine(dev); // break the frame into lines of 32 bytes, for the benefit of terminal programs
+
+		b = fetchByte(x);
+		crc = _crc_ccitt_update(crc, b);
+		text::hexByteOut(dev, b);
+
+	}
+
+	text::newLine(dev);
+	text::hexWordOut(dev, crc);
+	text::charOut(dev, '}');
+	text::newLine(dev);
+
+}
+
+static void paramTransfer::importReset(void)
+{
 
-	if (eePtr < eePtrStorageEnd) l = pgm_read_byte(&paramsLength[(uint16_t)(eePtr)]) & 0x07;
-	else l = 0;
+	ptByteCount = 0;
+	ptCRC = 0xFFFF;
+	ptFrameCRC = 0;
+	ptState = ptiWaitStart;
+
+}
+
+static uint8_t paramTransfer::importChar(uint8_t chr)
+{
+
+	uint8_t retVal;
+
+	retVal = ptsBusy;
+
+	switch (chr)
+	{
+
+		case '{':	// start of frame - discard anything received so far
+			importReset();
+			ptState = ptiHighNibble;
+			break;
+
+		case '}':	// end of frame - verify and store
+			if (ptState == ptiWaitStart) break;
+
+			if ((ptState != ptiHighNibble) || (ptByteCount != ptFrameLength)) retVal = ptsBadFrame;
+			else if (ptCRC != ptFrameCRC) retVal = ptsBadChecksum;
+			else retVal = apply();
+
+			ptState = ptiWaitStart;
+			break;
+
+		case 0x09:	// whitespace is ignored
+		case 0x0A:
+		case 0x0D:
+		case ' ':
+			break;
+
+		case 'a' ... 'f':
+			chr -= 32;
+		case 'A' ... 'F':
+			chr -= 7;
+		case '0' ... '9':
+			chr -= 48;
+
+			if (ptState == ptiWaitStart) break;
+
+			if (ptState == ptiHighNibble)
+			{
+
+				ptNibble = (chr << 4);
+				ptState = ptiLowNibble;
+
+			}
+			else
+			{
+
+				chr |= ptNibble;
+				ptState = ptiHighNibble;
+
+				if (ptByteCount < eeAdrParametersEnd)
+				{
+
+					ptBuffer[(uint16_t)(ptByteCount)] = chr;
+					ptCRC = _crc_ccitt_update(ptCRC, chr);
+
+				}
+				else if (ptByteCount < ptFrameLength) ptFrameCRC = (ptFrameCRC << 8) | chr;
+				else
+				{
+
+					retVal = ptsBadFrame; // too many bytes
+					ptState = ptiWaitStart;
+					break;
+
+				}
+
+				ptByteCount++;
+
+			}
+			break;
+
+		default:	// anything else inside a frame is an error
+			if (ptState == ptiWaitStart) break;
+
+			retVal = ptsBadFrame;
+			ptState = ptiWaitStart;
+			break;
+
+	}
+
+	return retVal;
+
+}
+
+static void paramTransfer::statusOut(interfaceDevice &dev, uint8_t status)
+{
+
+	text::stringOut(dev, ptStatusMsgs, status);
+	text::newLine(dev);
+
+}
+
+static uint8_t paramTransfer::fetchByte(uint16_t address)
+{
+
+#if defined(useEEPROMparameterCache)
+	return parameterCache[(uint16_t)(address)]; // the RAM copy may be newer than EEPROM
+#else // defined(useEEPROMparameterCache)
+	return EEPROM::readRawByte(address);
+#endif // defined(useEEPROMparameterCache)
+
+}
+
+static uint8_t paramTransfer::apply(void)
+{
+
+	uint16_t x;
+
+	// the signature holds the parameter count and settings size, so a mismatch means the frame belongs to a different build
+	for (x = pAddressSignature; x < pAddressSignature + byteSize(pSizeSignature); x++)
+		if (ptBuffer[(uint16_t)(x)] != fetchByte(x)) return ptsBadLayout;
+
+	for (x = eeAdrSignature; x < eeAdrParametersEnd; x++)
+	{
+
+#if defined(useEEPROMparameterCache)
+		if (parameterCache[(uint16_t)(x)] != ptBuffer[(uint16_t)(x)])
+		{
+
+			parameterCache[(uint16_t)(x)] = ptBuffer[(uint16_t)(x)];
+			parameterCacheDirty[(uint16_t)(x >> 3)] |= (1 << (x & 0x07));
+			parameterCacheDirtyFlag = 1;
+
+		}
+#else // defined(useEEPROMparameterCache)
+		if (EEPROM::readRawByte(x) != ptBuffer[(uint16_t)(x)]) EEPROM::writeRawByte(x, ptBuffer[(uint16_t)(x)]);
+#endif // defined(useEEPROMparameterCache)
+
+	}
 
-	t = getAddress(eePtr);
-	u = getAddress(++eePtr);
-	u -= t;
-	if (l) u--;
-	l += (u << 3);
+	EEPROM::initGuino(); // nearly every derived value may have changed, so recalculate all of them
+	EEPROM::flush(); // do not report success until every byte is actually in EEPROM
 
-	return l;
+	return ptsOK;
 
 }
 
+#endif // defined(useParameterTransfer)
@@ -118,6 +118,9 @@ static uint32_t SWEET64::runPrgm(const uint8_t * sched, uint8_t tripIdx)
 	uint8_t loopFlag;
 	uint8_t branchFlag;
 	uint8_t jumpVal;
+#if defined(useSeqlockTripAccess)
+	uint8_t tripSeq;
+#endif // defined(useSeqlockTripAccess)
 
 	union union_64 * regX;
 	union union_64 * regY;
@@ -297,11 +300,13 @@ static uint32_t SWEET64::runPrgm(const uint8_t * sched, uint8_t tripIdx)
 
 				case i07:	// load rX with volatile
 				case i08:	// store volatile rX
+#if !defined(useSeqlockTripAccess)
 #if defined(useBarFuelEconVsTime)
 				case i17:	// load rX with FEvT trip variable
 #endif // defined(useBarFuelEconVsTime)
 				case i18:	// load rX with trip variable
 				case i19:	// store trip variable rX
+#endif // !defined(useSeqlockTripAccess)
 					oldSREG = SREG; // save interrupt flag status
 					cli(); // disable interrupts
 				default:
@@ -388,8 +393,15 @@ static uint32_t SWEET64::runPrgm(const uint8_t * sched, uint8_t tripIdx)
 #endif // defined(useBarFuelEconVsTime)
 				case i18:	// load rX with trip variable
 					if (operand < tripSlotCount)
+#if defined(useSeqlockTripAccess)
+					do // if an interrupt handler updated any trip data in the meantime, read it in again
+#endif // defined(useSeqlockTripAccess)
 					{
 
+#if defined(useSeqlockTripAccess)
+						tripSeq = tripSeqCount;
+
+#endif // defined(useSeqlockTripAccess)
 						switch (extra)
 						{
 
@@ -423,6 +435,18 @@ static uint32_t SWEET64::runPrgm(const uint8_t * sched, uint8_t tripIdx)
 						}
 
 					}
+#if defined(useSeqlockTripAccess)
+					while (tripSeq != tripSeqCount);
+#endif // defined(useSeqlockTripAccess)
+#if defined(useBarFuelEconVsSpeed)
+					else if ((operand >= FEvsSpeedIdx) && (operand < FEvsSpeedIdx + bgDataSize)) bgFEvsSsupport::load64(regX, operand - FEvsSpeedIdx, extra);
+#endif // defined(useBarFuelEconVsSpeed)
+#if defined(useRollingTripWindows)
+					else if ((operand >= rolling10secondIdx) && (operand <= rolling30minuteIdx)) rollingTrip::load64(regX, operand - rolling10secondIdx, extra);
+#endif // defined(useRollingTripWindows)
+#if defined(useFuelLog)
+					else if ((operand >= fuelLogRecordIdx) && (operand <= fuelLogTotalIdx)) fuelLog::load64(regX, operand, extra);
+#endif // defined(useFuelLog)
 #if defined(useEEPROMtripStorage)
 					else
 					{
@@ -438,6 +462,10 @@ static uint32_t SWEET64::runPrgm(const uint8_t * sched, uint8_t tripIdx)
 					break;
 
 				case i19:	// store trip variable rX
+#if defined(useSeqlockTripAccess)
+					// main program stores go to trip slots that the interrupt handlers neither read nor write (saved, drag result,
+					//    instant/filtered, and terminal trips), so they do not need interrupts masked
+#endif // defined(useSeqlockTripAccess)
 					if (operand < tripSlotCount)
 					{
 
@@ -583,11 +611,13 @@ static uint32_t SWEET64::runPrgm(const uint8_t * sched, uint8_t tripIdx)
 
 				case i07:	// load rX with volatile
 				case i08:	// store volatile rX
+#if !defined(useSeqlockTripAccess)
 #if defined(useBarFuelEconVsTime)
 				case i17:	// load rX with FEvT trip variable
 #endif // defined(useBarFuelEconVsTime)
 				case i18:	// load rX with trip variable
 				case i19:	// store trip variable rX
+#endif // !defined(useSeqlockTripAccess)
 					SREG = oldSREG; // restore interrupt flag status
 				default:
 					break;
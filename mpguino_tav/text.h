@@ -8,6 +8,9 @@ namespace text /* text support section prototype */
 {
 
 	static uint8_t charIn(interfaceDevice &dev);
+#if defined(useBuffering)
+	static uint16_t freeSpace(interfaceDevice &dev);
+#endif // defined(useBuffering)
 
 	static void gotoXY(interfaceDevice &dev, uint8_t x, uint8_t y);
 	static void newLine(interfaceDevice &dev);
@@ -23,6 +26,9 @@ namespace text /* text support section prototype */
 	static void stringOut(interfaceDevice &dev, const char * str, uint8_t strIdx);
 	static void stringOut(interfaceDevice &dev, const char * str);
 	static void stringOut(interfaceDevice &dev, char * str);
+#if defined(useBuffering)
+	static void stringBlockOut(interfaceDevice &dev, const char * str, uint8_t progmemFlag);
+#endif // defined(useBuffering)
 	static void stringOutIf(interfaceDevice &dev, uint8_t condition, const char * str, uint8_t strIdx);
 	static void stringOutIf(interfaceDevice &dev, uint8_t condition, const char * str);
 	static void hexNybbleOut(interfaceDevice &dev, uint8_t val);
@@ -36,6 +42,10 @@ namespace text /* text support section prototype */
 
 };
 
+#if defined(useBuffering)
+static const uint8_t textBlockLength = 16; // must not exceed the smallest output device buffer size
+
+#endif // defined(useBuffering)
 static const char overFlowStr[] PROGMEM =	"----------";
 static const char overFlow9Str[] PROGMEM =	"9999999999";
 
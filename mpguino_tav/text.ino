@@ -12,6 +12,22 @@ static uint8_t text::charIn(interfaceDevice &dev)
 
 }
 
+#if defined(useBuffering)
+// returns how many bytes the device can accept without waiting - an unbuffered device always reports plenty of room
+static uint16_t text::freeSpace(interfaceDevice &dev)
+{
+
+	uint16_t retVal;
+
+	if (dev.outputBuffer) retVal = ringBuffer::freeSpace(* dev.outputBuffer);
+	else retVal = 65535;
+
+	return retVal;
+
+}
+
+#endif // defined(useBuffering)
+
 static void text::gotoXY(interfaceDevice &dev, uint8_t xPos, uint8_t yPos)
 {
 
@@ -191,6 +207,10 @@ static void text::stringOut(interfaceDevice &dev, const char * str, uint8_t strI
 static void text::stringOut(interfaceDevice &dev, const char * str)
 {
 
+#if defined(useBuffering)
+	if (dev.blkOut) stringBlockOut(dev, str, 1);
+	else
+#endif // defined(useBuffering)
 	while (charOut(dev, pgm_read_byte(str++))) ;
 
 }
@@ -198,10 +218,55 @@ static void text::stringOut(interfaceDevice &dev, const char * str)
 static void text::stringOut(interfaceDevice &dev, char * str)
 {
 
+#if defined(useBuffering)
+	if (dev.blkOut) stringBlockOut(dev, str, 0);
+	else
+#endif // defined(useBuffering)
 	while (charOut(dev, * str++));
 
 }
 
+#if defined(useBuffering)
+// hands each run of printable characters to the device as one block, and everything else to charOut
+static void text::stringBlockOut(interfaceDevice &dev, const char * str, uint8_t progmemFlag)
+{
+
+	char blk[(uint16_t)(textBlockLength)];
+	uint8_t len;
+	uint8_t chr;
+
+	while (1)
+	{
+
+		len = 0;
+
+		while (len < textBlockLength)
+		{
+
+			chr = ((progmemFlag) ? pgm_read_byte(str) : * str);
+
+			if ((chr < 0x20) || (chr > 0x7F) || ((dev.controlFlags & odvFlagEnableOutput) == 0)) break;
+
+			blk[(uint16_t)(len++)] = chr;
+			str++;
+
+		}
+
+		if (len) dev.blkOut((const uint8_t *)(blk), len);
+		else
+		{
+
+			str++;
+			if (charOut(dev, chr) == 0) break; // handle control character, and stop at end of string
+
+		}
+
+	}
+
+}
+
+#endif // defined(useBuffering)
+
 static void text::stringOutIf(interfaceDevice &dev, uint8_t condition, const char * str, uint8_t strIdx)
 {
 
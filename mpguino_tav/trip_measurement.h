@@ -22,6 +22,11 @@ const uint8_t rvEngCycleIdx = 4; 			// engine run time
 
 const uint8_t rvMeasuredCount = 5;
 
+#if defined(useEWMAtripFilter)
+// *** the filtered trip needs one fractional part main program variable for each trip variable field!!! ***
+typedef uint8_t ewmaFractionCountCheck[(mpEWMAfractionEndIdx - mpEWMAfractionIdx + 1 != rvMeasuredCount) ? -1 : 1];
+
+#endif // defined(useEWMAtripFilter)
 #if defined(useDebugTerminalLabels)
 static const char terminalTripVarLabels[] PROGMEM = {
 	"rvVSSpulseIdx" tcEOS
@@ -38,12 +43,19 @@ volatile uint8_t curRawTripIdx;
 #if defined(trackIdleEOCdata)
 volatile uint8_t curRawEOCidleTripIdx;
 #endif // defined(trackIdleEOCdata)
+#if defined(useSeqlockTripAccess)
+volatile uint8_t tripSeqCount; // bumped by every interrupt handler trip update - main program re-reads trip data if this changes mid-read
+#endif // defined(useSeqlockTripAccess)
 
 #if defined(useWindowTripFilter)
 const uint8_t windowTripFilterSize = 4;
 uint8_t wtpCurrentIdx;
 
 #endif // defined(useWindowTripFilter)
+#if defined(useEWMAtripFilter)
+uint8_t ewmaPrimed; // set once the filtered trip has been seeded with a real instant trip sample
+
+#endif // defined(useEWMAtripFilter)
 #define nextAllowedValue 0
 const uint8_t raw0tripIdx =				nextAllowedValue;
 const uint8_t raw1tripIdx =				raw0tripIdx + 1;
@@ -80,6 +92,16 @@ const uint8_t windowTripFilterIdx =		nextAllowedValue;
 #define nextAllowedValue windowTripFilterIdx + windowTripFilterSize
 #endif // defined(useWindowTripFilter)
 
+#if defined(useEWMAtripFilter)
+const uint8_t ewmaTripIdx =				nextAllowedValue;
+#define nextAllowedValue ewmaTripIdx + 1
+#endif // defined(useEWMAtripFilter)
+
+#if defined(useRollingTripWindows)
+const uint8_t rollingTripIdx =			nextAllowedValue;
+#define nextAllowedValue rollingTripIdx + 1
+#endif // defined(useRollingTripWindows)
+
 const uint8_t tripSlotFullCount =		nextAllowedValue;
 
 #if defined(useBarFuelEconVsTime)
@@ -88,12 +110,28 @@ const uint8_t FEvsTimeEndIdx =			FEvsTimeIdx + bgDataSize - 1;
 #define nextAllowedValue FEvsTimeEndIdx + 1
 #endif // defined(useBarFuelEconVsTime)
 
+const uint8_t tripSlotCount =			nextAllowedValue;
+
 #if defined(useBarFuelEconVsSpeed)
-const uint8_t FEvsSpeedIdx =			nextAllowedValue;
+const uint8_t FEvsSpeedIdx =			nextAllowedValue;	// one virtual trip per displayed fuel econ vs speed histogram bar
 #define nextAllowedValue FEvsSpeedIdx + bgDataSize
 #endif // defined(useBarFuelEconVsSpeed)
 
-const uint8_t tripSlotCount =			nextAllowedValue;
+#if defined(useRollingTripWindows)
+const uint8_t rolling10secondIdx =		nextAllowedValue;
+const uint8_t rolling1minuteIdx =		rolling10secondIdx + 1;
+const uint8_t rolling5minuteIdx =		rolling1minuteIdx + 1;
+const uint8_t rolling30minuteIdx =		rolling5minuteIdx + 1;
+#define nextAllowedValue rolling30minuteIdx + 1
+#endif // defined(useRollingTripWindows)
+
+#if defined(useFuelLog)
+const uint8_t fuelLogRecordIdx =		nextAllowedValue;	// fuel log record currently being viewed
+const uint8_t fuelLogMinFEidx =			fuelLogRecordIdx + 1;	// fuel log record with the lowest fuel economy figure
+const uint8_t fuelLogMaxFEidx =			fuelLogMinFEidx + 1;	// fuel log record with the highest fuel economy figure
+const uint8_t fuelLogTotalIdx =			fuelLogMaxFEidx + 1;	// sum of all fuel log records
+#define nextAllowedValue fuelLogTotalIdx + 1
+#endif // defined(useFuelLog)
 
 #if defined(useEEPROMtripStorage)
 const uint8_t EEPROMcurrentIdx =		nextAllowedValue;
@@ -138,6 +176,12 @@ static const char tripFormatLabelText[(uint16_t)(tripSlotTotalCount)] PROGMEM =
 	,'W'
 	,'W'
 #endif // defined(useWindowTripFilter)
+#if defined(useEWMAtripFilter)
+	,'e'
+#endif // defined(useEWMAtripFilter)
+#if defined(useRollingTripWindows)
+	,'R'
+#endif // defined(useRollingTripWindows)
 #if defined(useBarFuelEconVsTime)
 	,'P'						// ensure there are as many of these as is specified in bgDataSize
 	,'P'
@@ -172,6 +216,18 @@ static const char tripFormatLabelText[(uint16_t)(tripSlotTotalCount)] PROGMEM =
 	,'D'
 	,'E'
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useRollingTripWindows)
+	,'s'
+	,'m'
+	,'M'
+	,'L'
+#endif // defined(useRollingTripWindows)
+#if defined(useFuelLog)
+	,'g'
+	,'v'
+	,'^'
+	,'G'
+#endif // defined(useFuelLog)
 #if defined(useEEPROMtripStorage)
 	,'<'
 	,'('
@@ -200,6 +256,20 @@ static const uint8_t tripFormatDragFullSpeedIdx =	tripFormatDragHalfSpeedIdx + 1
 static const uint8_t tripFormatDragDistanceIdx =	tripFormatDragFullSpeedIdx + 1;
 #define nextAllowedValue tripFormatDragDistanceIdx + 1
 #endif // defined(useDragRaceFunction)
+#if defined(useRollingTripWindows)
+static const uint8_t tripFormatRolling10secondIdx =	nextAllowedValue;
+static const uint8_t tripFormatRolling1minuteIdx =	tripFormatRolling10secondIdx + 1;
+static const uint8_t tripFormatRolling5minuteIdx =	tripFormatRolling1minuteIdx + 1;
+static const uint8_t tripFormatRolling30minuteIdx =	tripFormatRolling5minuteIdx + 1;
+#define nextAllowedValue tripFormatRolling30minuteIdx + 1
+#endif // defined(useRollingTripWindows)
+#if defined(useFuelLog)
+static const uint8_t tripFormatFuelLogRecordIdx =	nextAllowedValue;
+static const uint8_t tripFormatFuelLogMinFEidx =	tripFormatFuelLogRecordIdx + 1;
+static const uint8_t tripFormatFuelLogMaxFEidx =	tripFormatFuelLogMinFEidx + 1;
+static const uint8_t tripFormatFuelLogTotalIdx =	tripFormatFuelLogMaxFEidx + 1;
+#define nextAllowedValue tripFormatFuelLogTotalIdx + 1
+#endif // defined(useFuelLog)
 
 static const uint8_t tripFormatIdxCount =			nextAllowedValue;
 
@@ -218,6 +288,18 @@ static const uint8_t tripFormatReverseList[] PROGMEM = {
 	,dragFullSpeedIdx
 	,dragDistanceIdx
 #endif // defined(useDragRaceFunction)
+#if defined(useRollingTripWindows)
+	,rolling10secondIdx
+	,rolling1minuteIdx
+	,rolling5minuteIdx
+	,rolling30minuteIdx
+#endif // defined(useRollingTripWindows)
+#if defined(useFuelLog)
+	,fuelLogRecordIdx
+	,fuelLogMinFEidx
+	,fuelLogMaxFEidx
+	,fuelLogTotalIdx
+#endif // defined(useFuelLog)
 };
 
 static const char tripFormatReverseNames[] PROGMEM = {
@@ -234,6 +316,18 @@ static const char tripFormatReverseNames[] PROGMEM = {
 	"DF/S" tcEOS
 	"DDST" tcEOS
 #endif // defined(useDragRaceFunction)
+#if defined(useRollingTripWindows)
+	"R10s" tcEOS
+	"R01m" tcEOS
+	"R05m" tcEOS
+	"R30m" tcEOS
+#endif // defined(useRollingTripWindows)
+#if defined(useFuelLog)
+	"LOGn" tcEOS
+	"LOG-" tcEOS
+	"LOG+" tcEOS
+	"LOGT" tcEOS
+#endif // defined(useFuelLog)
 };
 
 #if defined(useSpiffyTripLabels)
@@ -254,6 +348,18 @@ static const uint8_t tripFormatLabelCGRAM[][4] PROGMEM = {
 	,{0b00000000, 0b00000010, 0b00000101, 0b00000010} // full circle
 	,{0b00000000, 0b00000110, 0b00000101, 0b00000110} // D
 #endif // defined(useDragRaceFunction)
+#if defined(useRollingTripWindows)
+	,{0b00000000, 0b00000011, 0b00000010, 0b00000110} // small s
+	,{0b00000000, 0b00000110, 0b00000010, 0b00000111} // small 1
+	,{0b00000000, 0b00000111, 0b00000110, 0b00000011} // small 5
+	,{0b00000000, 0b00000111, 0b00000011, 0b00000111} // small 3
+#endif // defined(useRollingTripWindows)
+#if defined(useFuelLog)
+	,{0b00000000, 0b00000100, 0b00000100, 0b00000111} // small L
+	,{0b00000000, 0b00000101, 0b00000101, 0b00000010} // down arrowhead
+	,{0b00000000, 0b00000010, 0b00000101, 0b00000101} // up arrowhead
+	,{0b00000000, 0b00000010, 0b00000111, 0b00000010} // plus
+#endif // defined(useFuelLog)
 };
 
 #endif // defined(useSpiffyTripLabels)
@@ -293,6 +399,12 @@ static const char terminalTripVarNames[] PROGMEM = {
 	"windowTripFilterIdx[02]" tcEOS
 	"windowTripFilterIdx[03]" tcEOS
 #endif // defined(useWindowTripFilter)
+#if defined(useEWMAtripFilter)
+	"ewmaTripIdx" tcEOS
+#endif // defined(useEWMAtripFilter)
+#if defined(useRollingTripWindows)
+	"rollingTripIdx" tcEOS
+#endif // defined(useRollingTripWindows)
 #if defined(useBarFuelEconVsTime)
 	"FEvsTimeIdx[00]" tcEOS
 	"FEvsTimeIdx[01]" tcEOS
@@ -327,6 +439,18 @@ static const char terminalTripVarNames[] PROGMEM = {
 	"FEvsSpeedIdx[13]" tcEOS
 	"FEvsSpeedIdx[14]" tcEOS
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useRollingTripWindows)
+	"rolling10secondIdx" tcEOS
+	"rolling1minuteIdx" tcEOS
+	"rolling5minuteIdx" tcEOS
+	"rolling30minuteIdx" tcEOS
+#endif // defined(useRollingTripWindows)
+#if defined(useFuelLog)
+	"fuelLogRecordIdx" tcEOS
+	"fuelLogMinFEidx" tcEOS
+	"fuelLogMaxFEidx" tcEOS
+	"fuelLogTotalIdx" tcEOS
+#endif // defined(useFuelLog)
 #if defined(useEEPROMtripStorage)
 	"EEPROMcurrentIdx" tcEOS
 	"EEPROMtankIdx" tcEOS
@@ -353,6 +477,10 @@ namespace tripSupport /* Trip save/restore/reset support section prototype */
 #if defined(useWindowTripFilter)
 	static void resetWindowFilter(void);
 #endif // defined(useWindowTripFilter)
+#if defined(useEWMAtripFilter)
+	static void resetEWMAfilter(void);
+	static void ewmaFilter(void);
+#endif // defined(useEWMAtripFilter)
 
 };
 
@@ -366,6 +494,12 @@ static const uint8_t tripUpdateListSize = 3				// base trip update count
 #if defined(useBarFuelEconVsSpeed)
 	+ 1													// count of fuel econ vs speed bargraph trips to be updated
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useBarEngineLoad)
+	+ 1													// count of engine load histograms to be updated
+#endif // defined(useBarEngineLoad)
+#if defined(useRollingTripWindows)
+	+ 1													// count of rolling window running sum trips to be updated
+#endif // defined(useRollingTripWindows)
 #if defined(useWindowTripFilter)
 	+ 5													// count of window filter trips to be updated
 #endif // defined(useWindowTripFilter)
@@ -381,7 +515,8 @@ static const uint8_t tripUpdateListSize = 3				// base trip update count
 // 0x7E - non-active raw idle/EOC trip
 // 0x7D - currently active window trip
 // 0x7C - currently active fuel econ vs. time trip
-// 0x7B - currently active fuel econ vs. speed trip
+// 0x7B - currently active fuel econ vs. speed histogram bucket (not a trip variable - handled directly by the update loop)
+// 0x7A - engine speed vs. fuel injector duty cycle histogram (not a trip variable - handled directly by the update loop)
 //
 // in addition, the destination trip has a definable bit 7
 //  0b1xxx xxxx - transfer source trip to destination trip, and then reset the source trip
@@ -401,8 +536,14 @@ static const uint8_t tripUpdateList[(uint16_t)(tripUpdateListSize)][2] PROGMEM =
 	,{instantIdx				,0x7C}	 					// update fuel econ vs time bargraph trip with instant trip
 #endif // defined(useBarFuelEconVsTime)
 #if defined(useBarFuelEconVsSpeed)
-	,{instantIdx				,0x7B}						// update fuel econ vs speed bargraph trip with instant trip
+	,{instantIdx				,0x7B}						// update fuel econ vs speed histogram bucket with instant trip
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useBarEngineLoad)
+	,{instantIdx				,0x7A}						// update engine load histogram with unfiltered instant trip
+#endif // defined(useBarEngineLoad)
+#if defined(useRollingTripWindows)
+	,{instantIdx				,rollingTripIdx}			// update rolling window running sum trip with unfiltered instant trip
+#endif // defined(useRollingTripWindows)
 #if defined(useWindowTripFilter)
 	,{instantIdx				,0x7D | 0x80}				// transfer instant trip to current window trip
 	,{windowTripFilterIdx		,instantIdx}				// update instant trip with window trip 1
@@ -421,6 +562,47 @@ const uint8_t tripSelectList[] PROGMEM = {
 #endif // defined(trackIdleEOCdata)
 };
 
+#if defined(useRollingTripWindows)
+namespace rollingTrip /* rolling window trip support section prototype */
+{
+
+	static void init(void);
+	static void idleProcess(void);
+	static void load64(union union_64 * an, uint8_t windowIdx, uint8_t dataIdx);
+
+};
+
+// the rolling window trips are built from snapshots of the low 32 bits of a running sum trip (rollingTripIdx), taken every sample
+//
+// any window is then just the current running sum minus the snapshot taken at the start of the window. Subtraction is done modulo 2^32,
+//    which stays exact as long as no single measurement grows by 2^32 or more within a window - even 30 minutes of timer0 cycles is well short of that
+//
+// short windows come from a ring of snapshots taken every sample. Longer windows come from a second ring of snapshots taken every
+//    rtCoarseSampleCount samples. Longer windows therefore lag by up to one coarse snapshot period, but remain constant time to compute
+//
+const uint8_t rtFineSize =				32;							// must be a power of 2, and larger than the longest fine window
+const uint8_t rtFineMask =				rtFineSize - 1;
+const uint8_t rtCoarseSize =			128;						// must be a power of 2, and larger than the longest coarse window
+const uint8_t rtCoarseMask =			rtCoarseSize - 1;
+const uint8_t rtCoarseSampleCount =		30 * loopsPerSecond / 2;	// 15 seconds worth of samples per coarse snapshot
+
+const uint8_t rtCoarseFlag =			0x80;						// window is measured off of coarse snapshot ring
+const uint8_t rtCountMask =				0x7F;						// number of snapshots in window
+
+static const uint8_t rollingWindowList[] PROGMEM = {
+	 (10 * loopsPerSecond)										// 10 second window, in samples
+	,rtCoarseFlag | (60 / 15 + 1)								// 1 minute window, in coarse snapshots
+	,rtCoarseFlag | (300 / 15 + 1)								// 5 minute window, in coarse snapshots
+	,rtCoarseFlag | (1800 / 15 + 1)								// 30 minute window, in coarse snapshots
+};
+
+static uint32_t rtFineSnapshot[(uint16_t)(rtFineSize)][(uint16_t)(rvMeasuredCount)];
+static uint32_t rtCoarseSnapshot[(uint16_t)(rtCoarseSize)][(uint16_t)(rvMeasuredCount)];
+static uint8_t rtFineHead;
+static uint8_t rtCoarseHead;
+static uint8_t rtCoarseCount;
+
+#endif // defined(useRollingTripWindows)
 #if defined(useChryslerMAPCorrection)
 namespace pressureCorrect /* Chrysler returnless fuel pressure correction display section prototype */
 {
@@ -535,3 +717,142 @@ static const char prStatusMessages[] PROGMEM = {
 
 #endif // defined(usePartialRefuel)
 #endif // defined(useEnhancedTripReset)
+#if defined(useFuelLog)
+namespace fuelLog /* fuel-up history log support section prototype */
+{
+
+	static void init(void);
+	static void addTank(void);
+	static void scan(void);
+	static uint8_t getRecordIdx(uint8_t age);
+	static void load64(union union_64 * an, uint8_t tripIdx, uint8_t dataIdx);
+	static uint8_t transferRecord(uint8_t recordIdx, uint8_t mode);
+	static void transferBytes(uint8_t * buff, uint8_t len, uint8_t mode);
+#if defined(useButtonInput)
+	static uint8_t displayHandler(uint8_t cmd, uint8_t cursorPos);
+	static uint16_t getFuelLogPageFormat(uint8_t formatIdx);
+#endif // defined(useButtonInput)
+#if defined(useDataLoggingOutput)
+	static void outputDataLog(void);
+	static void outputDataLogLine(uint8_t tripIdx);
+#endif // defined(useDataLoggingOutput)
+
+};
+
+// the fuel log is a small ring of fixed size records, one per completed tank, kept in EEPROM just past the display cursor positions
+//
+// a tank gets logged whenever the tank trip is reset, provided it holds any distance or fuel. Each record holds a sequence number,
+//    the tank distance, fuel used, and engine run time, and a CRC. The fields are packed using the same bit lengths as stored
+//    parameters, so they take only as many bytes as each one needs
+//
+// the fuel log is viewed through virtual trip variables - the record being browsed, the records with the lowest and highest fuel economy,
+//    and the sum of all records. The latter three are recalculated by scan() whenever the log changes or the log display is entered
+//
+static const uint8_t flSizeSequence =		16;
+static const uint8_t flSizeVSSpulse =		32;		// tank distance, in VSS pulses
+static const uint8_t flSizeInjCycle =		48;		// tank fuel used, in fuel injector open timer0 cycles
+static const uint8_t flSizeEngCycle =		48;		// tank engine run time, in timer0 cycles
+
+#define fuelLogField(rvIdx, bitLength) (((uint16_t)(rvIdx) << 8) | (bitLength))
+
+static const uint16_t fuelLogFields[] PROGMEM = {
+	 fuelLogField(rvVSSpulseIdx, flSizeVSSpulse)
+	,fuelLogField(rvInjCycleIdx, flSizeInjCycle)
+	,fuelLogField(rvEngCycleIdx, flSizeEngCycle)
+};
+
+const uint8_t flFieldCount =			sizeof(fuelLogFields) / sizeof(uint16_t);
+const uint8_t flDistanceFieldIdx =		0;		// position of tank distance within fuelLogFields
+const uint8_t flFuelFieldIdx =			1;		// position of tank fuel used within fuelLogFields
+const uint16_t flRecordSize =			byteSize(flSizeSequence) + byteSize(flSizeVSSpulse) + byteSize(flSizeInjCycle) + byteSize(flSizeEngCycle)
+											+ sizeof(uint16_t); // sequence number, fields, CRC
+const uint8_t flMaxRecordCount =		8;		// must be no more than 8, as valid records are tracked by a bitmask
+const uint16_t eeAdrFuelLogStart =		eeAdrStorageEnd;
+const uint8_t flRecordCount =			((E2END + 1 - eeAdrFuelLogStart) / flRecordSize < flMaxRecordCount)
+											? (E2END + 1 - eeAdrFuelLogStart) / flRecordSize : flMaxRecordCount;
+const uint16_t eeAdrFuelLogEnd =		eeAdrFuelLogStart + flRecordCount * flRecordSize;
+
+const uint8_t flmVerify =				0;	// read record and check its CRC
+const uint8_t flmLoad =					1;	// read record into flFields
+const uint8_t flmStore =				2;	// write flFields into record
+
+static union union_64 flFields[(uint16_t)(flFieldCount)];	// record being transferred to or from EEPROM
+static union union_64 flTotals[(uint16_t)(flFieldCount)];	// sum of all valid records
+static uint16_t flSequence;					// sequence number given to the next record written
+static uint16_t flRecordSequence;			// sequence number of the last record read
+static uint8_t flValidRecords;				// bitmask of records that passed their CRC check
+static uint8_t flNewestRecordIdx;			// newest valid record, or flRecordCount if there is none
+static uint8_t flViewIdx;					// record shown through fuelLogRecordIdx, or flRecordCount for none
+static uint8_t flMinFEidx;					// record shown through fuelLogMinFEidx, or flRecordCount for none
+static uint8_t flMaxFEidx;					// record shown through fuelLogMaxFEidx, or flRecordCount for none
+static uint16_t flAddress;
+static uint16_t flCRC;
+
+#if defined(useButtonInput)
+static const uint8_t flSummaryPageCount =	2;
+static const uint8_t flDisplayPageCount =	flSummaryPageCount + flMaxRecordCount;
+
+#endif // defined(useButtonInput)
+#endif // defined(useFuelLog)
+#if defined(useTripJournal)
+namespace tripJournal /* rotating trip autosave journal support section prototype */
+{
+
+	static void init(void);
+	static void erase(void);
+	static void resetCountdown(void);
+	static void requestWrite(void);
+	static void idleProcess(void);
+	static void mainProcess(void);
+	static uint8_t read(void);
+	static uint8_t write(void);
+	static uint8_t transferRecord(uint8_t recordIdx, uint8_t mode);
+	static void transferBytes(uint8_t * buff, uint8_t len, uint8_t mode);
+
+};
+
+// the trip journal is a ring of fixed size records, filling all EEPROM space past the parameters, display pages, cursor positions, and fuel log
+//
+// each record holds a sequence number, a copy of every journaled trip, and a CRC. Each autosave overwrites the oldest record in the ring,
+//    which spreads EEPROM wear across the whole journal area. A record cut short by sudden power loss fails its CRC check, so the record
+//    before it is the one restored at power-up
+//
+// when overwriting the oldest record, only those bytes that actually differ are programmed into EEPROM
+//
+static const uint8_t tripJournalList[] PROGMEM = {
+	 currentIdx
+	,tankIdx
+#if defined(trackIdleEOCdata)
+	,eocIdleCurrentIdx
+	,eocIdleTankIdx
+#endif // defined(trackIdleEOCdata)
+};
+
+const uint8_t tjTripCount =				sizeof(tripJournalList);
+const uint8_t tjTripSize =				sizeof(collectedVSSpulseCount[0]) + sizeof(collectedVSScycleCount[0]) + sizeof(collectedInjPulseCount[0])
+											+ sizeof(collectedInjCycleCount[0]) + sizeof(collectedEngCycleCount[0]);
+const uint16_t tjRecordSize =			sizeof(uint16_t) + tjTripCount * tjTripSize + sizeof(uint16_t);	// sequence number, journaled trips, CRC
+#if defined(useFuelLog)
+const uint16_t eeAdrJournalStart =		eeAdrFuelLogEnd;
+#else // defined(useFuelLog)
+const uint16_t eeAdrJournalStart =		eeAdrStorageEnd;
+#endif // defined(useFuelLog)
+const uint8_t tjRecordCount =			(E2END + 1 - eeAdrJournalStart) / tjRecordSize;
+
+// *** the trip journal needs room in EEPROM for at least 2 records, or a sudden power loss while writing can lose the journaled trips!!! ***
+typedef uint8_t tjRecordCountCheck[(tjRecordCount < 2) ? -1 : 1];
+
+const uint8_t tjmVerify =				0;	// read record and check its CRC
+const uint8_t tjmLoad =					1;	// read record into journaled trips
+const uint8_t tjmStore =				2;	// write journaled trips into record
+
+static uint16_t tjSequence;					// sequence number given to the next record written
+static uint16_t tjRecordSequence;			// sequence number of the last record read
+static uint8_t tjNextRecordIdx;				// journal record to be overwritten next
+static uint8_t tjNewestRecordIdx;			// newest valid journal record, or tjRecordCount if there is none
+static uint16_t tjCountdown;				// samples left before the next autosave, or 0 if periodic autosave is off
+static uint8_t tjWritePending;
+static uint16_t tjAddress;
+static uint16_t tjCRC;
+
+#endif // defined(useTripJournal)
@@ -135,6 +135,10 @@ static void tripVar::update64(uint64_t collectedCycleArray[], uint32_t value, ui
 #else // defined(useAssemblyLanguage)
 	collectedCycleArray[(uint16_t)(destTripIdx)] += value;
 #endif // defined(useAssemblyLanguage)
+#if defined(useSeqlockTripAccess)
+
+	tripSeqCount++; // signal to main program that trip data has changed
+#endif // defined(useSeqlockTripAccess)
 
 }
 
@@ -183,6 +187,9 @@ static void tripVar::update64(uint64_t collectedCycleArray[], uint32_t collected
 #endif // defined(useAssemblyLanguage)
 
 	collectedPulseArray[(uint16_t)(destTripIdx)]++;
+#if defined(useSeqlockTripAccess)
+	tripSeqCount++; // signal to main program that trip data has changed
+#endif // defined(useSeqlockTripAccess)
 
 }
 
@@ -295,6 +302,35 @@ static void tripSupport::init(void)
 
 	uint8_t oldSREG;
 
+#if defined(useSeqlockTripAccess)
+	// interrupt handlers only ever write to the current raw trip slots, so clear everything else first
+	curRawTripIdx = raw0tripIdx;
+#if defined(trackIdleEOCdata)
+	curRawEOCidleTripIdx = raw0eocIdleTripIdx;
+#endif // defined(trackIdleEOCdata)
+
+	for (uint8_t x = 0; x < tripSlotCount; x++)
+		if ((x != raw0tripIdx)
+#if defined(trackIdleEOCdata)
+			&& (x != raw0eocIdleTripIdx)
+#endif // defined(trackIdleEOCdata)
+		) tripVar::reset(x);
+
+	oldSREG = SREG; // save interrupt flag status
+	cli(); // switch both raw trip indices to the freshly cleared raw slots as one step
+
+	curRawTripIdx = raw1tripIdx;
+#if defined(trackIdleEOCdata)
+	curRawEOCidleTripIdx = raw1eocIdleTripIdx;
+#endif // defined(trackIdleEOCdata)
+
+	SREG = oldSREG; // restore interrupt flag status
+
+	tripVar::reset(raw0tripIdx);
+#if defined(trackIdleEOCdata)
+	tripVar::reset(raw0eocIdleTripIdx);
+#endif // defined(trackIdleEOCdata)
+#else // defined(useSeqlockTripAccess)
 	oldSREG = SREG; // save interrupt flag status
 	cli(); // disable interrupts to make the next operations atomic
 
@@ -306,6 +342,11 @@ static void tripSupport::init(void)
 	for (uint8_t x = 0; x < tripSlotCount; x++) tripVar::reset(x);
 
 	SREG = oldSREG; // restore interrupt flag status
+#endif // defined(useSeqlockTripAccess)
+#if defined(useRollingTripWindows)
+
+	rollingTrip::init();
+#endif // defined(useRollingTripWindows)
 
 }
 
@@ -316,6 +357,9 @@ static void tripSupport::idleProcess(void)
 	uint8_t k;
 	uint8_t m;
 
+	// both raw trip indices have to switch as one step, even with useSeqlockTripAccess, so that no interrupt handler ever
+	//    updates the new raw trip together with the old raw EOC/idle trip, or the other way around. Interrupt handlers run
+	//    to completion, so once the indices are switched, no handler can be in the middle of updating the old raw trip slots
 	oldSREG = SREG; // save interrupt flag status
 	cli(); // disable interrupts to make the next operations atomic
 
@@ -332,6 +376,14 @@ static void tripSupport::idleProcess(void)
 		k = translateTripIndex(x, 0);
 		m = translateTripIndex(x, 1);
 
+#if defined(useBarFuelEconVsSpeed)
+		if (m == 0x7B) bgFEvsSsupport::update(k); // add source trip to current fuel econ vs speed histogram bucket
+		else
+#endif // defined(useBarFuelEconVsSpeed)
+#if defined(useBarEngineLoad)
+		if (m == 0x7A) bgEngineLoad::update(k); // classify source trip into engine load histogram
+		else
+#endif // defined(useBarEngineLoad)
 		if (m > raw1tripIdx) // if a valid target trip variable was specified
 		{
 
@@ -348,6 +400,10 @@ static void tripSupport::idleProcess(void)
 
 	}
 
+#if defined(useRollingTripWindows)
+	rollingTrip::idleProcess();
+
+#endif // defined(useRollingTripWindows)
 #if defined(useWindowTripFilter)
 	if (awakeFlags & aAwakeOnVehicle)
 	{
@@ -358,6 +414,10 @@ static void tripSupport::idleProcess(void)
 	}
 
 #endif // defined(useWindowTripFilter)
+#if defined(useEWMAtripFilter)
+	ewmaFilter();
+
+#endif // defined(useEWMAtripFilter)
 }
 
 static uint8_t tripSupport::translateTripIndex(uint8_t tripTransferIdx, uint8_t tripDirIndex)
@@ -395,11 +455,15 @@ static uint8_t tripSupport::translateTripIndex(uint8_t tripTransferIdx, uint8_t
 
 #endif // defined(useBarFuelEconVsTime)
 #if defined(useBarFuelEconVsSpeed)
-		case 0x7B:	// replace generic fuel econ vs speed trip index with current fuel econ vs speed trip index
-			i = FEvSpdTripIdx;
-			break;
+		case 0x7B:	// fuel econ vs speed histogram is not made of trip variables, so pass this index through untouched
+			return j;
 
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useBarEngineLoad)
+		case 0x7A:	// neither is the engine load histogram
+			return j;
+
+#endif // defined(useBarEngineLoad)
 		default:
 			break;
 
@@ -415,12 +479,16 @@ static uint8_t tripSupport::translateTripIndex(uint8_t tripTransferIdx, uint8_t
 static void tripSupport::doResetTrip(uint8_t tripSlot)
 {
 
+#if defined(useFuelLog)
+	if (tripSlot) fuelLog::addTank(); // log the tank trip before it goes away
+
+#endif // defined(useFuelLog)
 	tripVar::reset(pgm_read_byte(&tripSelectList[(uint16_t)(tripSlot)]));
 #if defined(trackIdleEOCdata)
 	tripVar::reset(pgm_read_byte(&tripSelectList[(uint16_t)(tripSlot + 2)]));
 #endif // defined(trackIdleEOCdata)
 
-#if defined(useBarFuelEconVsSpeed) || defined(usePartialRefuel)
+#if defined(useBarFuelEconVsSpeed) || defined(useBarEngineLoad) || defined(usePartialRefuel)
 	if (tripSlot)
 	{
 
@@ -428,13 +496,22 @@ static void tripSupport::doResetTrip(uint8_t tripSlot)
 		bgFEvsSsupport::reset();
 
 #endif // defined(useBarFuelEconVsSpeed)
+#if defined(useBarEngineLoad)
+		bgEngineLoad::reset();
+
+#endif // defined(useBarEngineLoad)
 #if defined(usePartialRefuel)
 		EEPROM::writeByte(pRefuelSizeIdx, 0); // since we're zeroing out pRefuelSizeIdx, we can use writeByte instead of writeVal
+		if (derivedValueFlags) EEPROM::recomputeDerivedValues(derivedValueFlags); // partial refuel size feeds derived fuel quantities
 
 #endif // defined(usePartialRefuel)
 	}
 
-#endif // defined(useBarFuelEconVsSpeed) || defined(usePartialRefuel)
+#endif // defined(useBarFuelEconVsSpeed) || defined(useBarEngineLoad) || defined(usePartialRefuel)
+#if defined(useTripJournal)
+	tripJournal::requestWrite(); // journal the reset trip soon, so that a sudden power loss does not bring the old trip back
+
+#endif // defined(useTripJournal)
 }
 
 #if defined(useEnhancedTripReset)
@@ -590,9 +667,14 @@ static uint8_t tripSave::doAutoAction(uint8_t taaMode)
 	if (EEPROM::readByte(pAutoSaveActiveIdx))
 	{
 
+#if defined(useTripJournal)
+		if (taaMode) retVal = tripJournal::read();
+		else retVal = tripJournal::write();
+#else // defined(useTripJournal)
 		for (uint8_t x = 0; x < 2; x++)
 			if (taaMode) retVal |= doReadTrip(x);
 			else retVal |= doWriteTrip(x);
+#endif // defined(useTripJournal)
 
 	}
 
@@ -609,6 +691,8 @@ static uint8_t tripSave::doReadTrip(uint8_t tripSlot)
 	if (tripSlot) retVal += SWEET64::runPrgm(prgmLoadTankFromEEPROM, 0);
 	else retVal += SWEET64::runPrgm(prgmLoadCurrentFromEEPROM, 0);
 
+	if (derivedValueFlags) EEPROM::recomputeDerivedValues(derivedValueFlags); // loading the tank trip may also restore partial refuel size
+
 	return retVal;
 
 }
@@ -663,6 +747,170 @@ static void tripSupport::resetWindowFilter(void)
 }
 
 #endif // defined(useWindowTripFilter)
+#if defined(useEWMAtripFilter)
+static void tripSupport::resetEWMAfilter(void)
+{
+
+	ewmaPrimed = 0;
+
+	tripVar::reset(ewmaTripIdx);
+
+}
+
+// filtered += (instant - filtered) / (time constant * samples per second), done once per trip variable field
+//
+// the filtered trip holds the whole part of each filtered trip variable field, so it reads like any other trip - the
+//    fractional part (in 1/256 units) is kept in a main program variable, so that small differences still move the
+//    filtered value between samples
+//
+// the filtered value is then rounded, and replaces the instant trip variable field
+static const uint8_t prgmEWMAfilter[] PROGMEM = {
+	instrLdRegEEPROM, 0x02, pEWMAtimeConstantIdx,		// fetch filter time constant in seconds
+	instrMul2byByte, loopsPerSecond,					// convert time constant into a count of samples
+	instrTestReg, 0x02,									// is sample count zero?
+	instrBranchIfNotE, 3,								// if not, skip
+	instrLdRegByte, 0x02, 1,							// a sample count of one disables filtering
+
+//cont0:
+	instrStRegMain, 0x02, mpEWMAsampleCountIdx,			// save sample count
+	instrLxdI, rvMeasuredCount,
+
+//loop:
+	instrAddIndex, 255,									// decrement index
+	instrLdRegTripVarIndexedRV, 0x02, ewmaTripIdx,		// fetch whole part of filtered trip variable field
+	instrMul2byByte, 128,								// scale it up by 256
+	instrShiftRegLeft, 0x02,
+	instrLdRegMainOffset, 0x01, mpEWMAfractionIdx,		// fetch fractional part of filtered trip variable field
+	instrAddYtoX, 0x12,									// add it in
+	instrLdReg, 0x23,									// save scaled filtered value
+	instrLdRegTripVarIndexedRV, 0x02, instantIdx,		// fetch instant trip variable field
+	instrMul2byByte, 128,								// scale it up by 256
+	instrShiftRegLeft, 0x02,
+	instrCmpXtoY, 0x23,									// is filtered value greater than scaled instant value?
+	instrBranchIfGT, 9,									// if so, go subtract from filtered value
+	instrSubYfromX, 0x32,								// find difference between scaled instant value and filtered value
+	instrDiv2byMain, mpEWMAsampleCountIdx,				// divide difference by sample count
+	instrAdjustQuotient,								// bump up quotient by adjustment term (0 if remainder/divisor < 0.5, 1 if remainder/divisor >= 0.5)
+	instrAddYtoX, 0x23,									// add divided difference to filtered value
+	instrSkip, 11,										// go save filtered value
+
+//cont1:
+	instrLdReg, 0x21,									// save scaled instant value
+	instrLdReg, 0x32,									// recall filtered value
+	instrSubYfromX, 0x12,								// find difference between filtered value and scaled instant value
+	instrDiv2byMain, mpEWMAsampleCountIdx,				// divide difference by sample count
+	instrAdjustQuotient,								// bump up quotient by adjustment term (0 if remainder/divisor < 0.5, 1 if remainder/divisor >= 0.5)
+	instrSubYfromX, 0x23,								// subtract divided difference from filtered value
+
+//cont2:
+	instrLdReg, 0x32,									// recall filtered value
+	instrLdRegByte, 0x01, 128,							// split it into whole and fractional parts
+	instrShiftRegLeft, 0x01,
+	instrDiv2by1,
+	instrStRegTripVarIndexedRV, 0x02, ewmaTripIdx,		// save whole part of filtered trip variable field
+	instrAddIndex, mpEWMAfractionIdx,					// point index to fractional part of filtered trip variable field
+	instrStRegMainIndexed, 0x01,						// save fractional part (division remainder)
+	instrAddIndex, 256 - mpEWMAfractionIdx,				// restore index
+	instrAdjustQuotient,								// round whole part by fractional part
+	instrStRegTripVarIndexedRV, 0x02, instantIdx,		// replace instant trip variable field with it
+	instrTestIndex,										// processed through all trip variable fields?
+	instrBranchIfNotE, 185,								// if not, loop back
+	instrDone											// return to caller
+};
+
+// the filtered trip replaces the instant trip, after the instant trip has already been added to every accumulating trip
+static void tripSupport::ewmaFilter(void)
+{
+
+	if (ewmaPrimed) SWEET64::runPrgm(prgmEWMAfilter, 0); // if the filtered trip already holds something meaningful, go filter
+	else if (awakeFlags & aAwakeOnVehicle) // otherwise, seed the filtered trip with the first instant trip taken while the vehicle is running
+	{
+
+		tripVar::transfer(instantIdx, ewmaTripIdx);
+		for (uint8_t x = 0; x < rvMeasuredCount; x++) mainProgramVariables[(uint16_t)(mpEWMAfractionIdx + x)] = 0;
+		ewmaPrimed = 1;
+
+	}
+
+}
+
+#endif // defined(useEWMAtripFilter)
+#if defined(useRollingTripWindows)
+/* rolling window trip support section */
+
+static void rollingTrip::init(void)
+{
+
+	for (uint8_t x = 0; x < rtFineSize; x++)
+		for (uint8_t y = 0; y < rvMeasuredCount; y++) rtFineSnapshot[(uint16_t)(x)][(uint16_t)(y)] = 0;
+
+	for (uint8_t x = 0; x < rtCoarseSize; x++)
+		for (uint8_t y = 0; y < rvMeasuredCount; y++) rtCoarseSnapshot[(uint16_t)(x)][(uint16_t)(y)] = 0;
+
+	rtFineHead = 0;
+	rtCoarseHead = 0;
+	rtCoarseCount = rtCoarseSampleCount;
+
+	tripVar::reset(rollingTripIdx);
+
+}
+
+static void rollingTrip::idleProcess(void)
+{
+
+	uint32_t * snapshot;
+
+	snapshot = rtFineSnapshot[(uint16_t)(rtFineHead)];
+
+	// take a snapshot of the low 32 bits of the running sum trip
+	snapshot[(uint16_t)(rvVSSpulseIdx)] = collectedVSSpulseCount[(uint16_t)(rollingTripIdx)];
+	snapshot[(uint16_t)(rvVSScycleIdx)] = ((union union_64 *)&collectedVSScycleCount[(uint16_t)(rollingTripIdx)])->ul[0];
+	snapshot[(uint16_t)(rvInjPulseIdx)] = collectedInjPulseCount[(uint16_t)(rollingTripIdx)];
+	snapshot[(uint16_t)(rvInjCycleIdx)] = ((union union_64 *)&collectedInjCycleCount[(uint16_t)(rollingTripIdx)])->ul[0];
+	snapshot[(uint16_t)(rvEngCycleIdx)] = ((union union_64 *)&collectedEngCycleCount[(uint16_t)(rollingTripIdx)])->ul[0];
+
+	rtFineHead++;
+	rtFineHead &= rtFineMask;
+
+	rtCoarseCount--;
+
+	if (rtCoarseCount == 0) // if it's time to take a coarse snapshot, copy the fine snapshot just taken
+	{
+
+		rtCoarseCount = rtCoarseSampleCount;
+
+		for (uint8_t x = 0; x < rvMeasuredCount; x++) rtCoarseSnapshot[(uint16_t)(rtCoarseHead)][(uint16_t)(x)] = snapshot[(uint16_t)(x)];
+
+		rtCoarseHead++;
+		rtCoarseHead &= rtCoarseMask;
+
+	}
+
+}
+
+static void rollingTrip::load64(union union_64 * an, uint8_t windowIdx, uint8_t dataIdx)
+{
+
+	uint32_t * oldSnapshot;
+	uint8_t i;
+
+	if (dataIdx < rvMeasuredCount)
+	{
+
+		i = pgm_read_byte(&rollingWindowList[(uint16_t)(windowIdx)]);
+
+		if (i & rtCoarseFlag) oldSnapshot = rtCoarseSnapshot[(uint16_t)((rtCoarseHead - (i & rtCountMask)) & rtCoarseMask)];
+		else oldSnapshot = rtFineSnapshot[(uint16_t)((rtFineHead - 1 - i) & rtFineMask)];
+
+		// most recent fine snapshot minus snapshot at start of window yields window sum
+		SWEET64::init64(an, rtFineSnapshot[(uint16_t)((rtFineHead - 1) & rtFineMask)][(uint16_t)(dataIdx)] - oldSnapshot[(uint16_t)(dataIdx)]);
+
+	}
+	else SWEET64::init64byt(an, 0);
+
+}
+
+#endif // defined(useRollingTripWindows)
 #if defined(useChryslerMAPCorrection)
 /* Chrysler returnless fuel pressure correction display section */
 
@@ -740,3 +988,599 @@ static uint16_t pressureCorrect::getPressureCorrectPageFormats(uint8_t formatIdx
 }
 
 #endif // defined(useChryslerMAPCorrection)
+#if defined(useTripJournal)
+/* rotating trip autosave journal support section */
+
+// find the newest valid journal record, and figure out where the next record goes
+static void tripJournal::init(void)
+{
+
+	uint16_t newestSequence = 0;
+
+	tjNewestRecordIdx = tjRecordCount;
+
+	for (uint8_t x = 0; x < tjRecordCount; x++)
+		if (transferRecord(x, tjmVerify))
+		{
+
+			// sequence numbers are compared modulo 65536, so that they may safely wrap around
+			if ((tjNewestRecordIdx == tjRecordCount) || ((int16_t)(tjRecordSequence - newestSequence) > 0))
+			{
+
+				tjNewestRecordIdx = x;
+				newestSequence = tjRecordSequence;
+
+			}
+
+		}
+
+	if (tjNewestRecordIdx < tjRecordCount)
+	{
+
+		tjSequence = newestSequence + 1;
+		tjNextRecordIdx = tjNewestRecordIdx + 1;
+		if (tjNextRecordIdx == tjRecordCount) tjNextRecordIdx = 0;
+
+	}
+	else
+	{
+
+		tjSequence = 0;
+		tjNextRecordIdx = 0;
+
+	}
+
+	resetCountdown();
+
+}
+
+// invalidates every journal record, so that trips journaled under an earlier EEPROM layout or parameter set are not restored
+//
+// only the last CRC byte of each valid record is changed, which keeps the number of EEPROM writes down to one per record
+static void tripJournal::erase(void)
+{
+
+	for (uint8_t x = 0; x < tjRecordCount; x++)
+		if (transferRecord(x, tjmVerify)) EEPROM::writeRawByte(tjAddress - 1, ~(EEPROM::readRawByte(tjAddress - 1)));
+
+}
+
+static void tripJournal::resetCountdown(void)
+{
+
+	tjCountdown = (uint16_t)(EEPROM::readByte(pJournalIntervalIdx)) * 60 * loopsPerSecond;
+
+}
+
+// called whenever a journaled trip gets reset, so that a sudden power loss does not bring the old trip back
+static void tripJournal::requestWrite(void)
+{
+
+	tjCountdown = 1;
+
+}
+
+static void tripJournal::idleProcess(void)
+{
+
+	if (tjCountdown) // if periodic autosave is on, or if a journal write was requested
+	{
+
+		if ((awakeFlags & aAwakeOnVehicle) || (tjCountdown == 1)) tjCountdown--; // periodic autosave only counts time while the vehicle is in use
+
+		if (tjCountdown == 0) tjWritePending = 1; // EEPROM writes are too slow for idleProcess, so leave them to the main program
+
+	}
+
+}
+
+static void tripJournal::mainProcess(void)
+{
+
+	if (tjWritePending)
+	{
+
+		tjWritePending = 0;
+
+		tripSave::doAutoAction(taaModeWrite);
+		resetCountdown();
+
+	}
+
+}
+
+static uint8_t tripJournal::read(void)
+{
+
+	uint8_t retVal = 0;
+
+	// the newest record was already verified by init(), so no partially written data can make it into the journaled trips
+	if (tjNewestRecordIdx < tjRecordCount) retVal = transferRecord(tjNewestRecordIdx, tjmLoad);
+
+	return retVal;
+
+}
+
+static uint8_t tripJournal::write(void)
+{
+
+	uint8_t retVal = 0;
+
+	if (tjRecordCount)
+	{
+
+		transferRecord(tjNextRecordIdx, tjmStore);
+
+		tjNewestRecordIdx = tjNextRecordIdx;
+
+		tjNextRecordIdx++;
+		if (tjNextRecordIdx == tjRecordCount) tjNextRecordIdx = 0;
+
+		tjSequence++;
+
+		retVal = 1;
+
+	}
+
+	return retVal;
+
+}
+
+// returns 1 if the record CRC matches
+//
+// the CRC is seeded with the journal start address, so that records left over from a different EEPROM layout are not mistaken for valid ones
+static uint8_t tripJournal::transferRecord(uint8_t recordIdx, uint8_t mode)
+{
+
+	uint8_t i;
+	uint16_t c;
+	union union_16 crc;
+
+	tjAddress = eeAdrJournalStart + (uint16_t)(recordIdx) * tjRecordSize;
+	tjCRC = eeAdrJournalStart;
+
+	if (mode == tjmStore) transferBytes((uint8_t *)(&tjSequence), sizeof(tjSequence), tjmStore);
+	else transferBytes((uint8_t *)(&tjRecordSequence), sizeof(tjRecordSequence), tjmLoad);
+
+	for (uint8_t x = 0; x < tjTripCount; x++)
+	{
+
+		i = pgm_read_byte(&tripJournalList[(uint16_t)(x)]);
+
+		transferBytes((uint8_t *)(&collectedVSSpulseCount[(uint16_t)(i)]), sizeof(collectedVSSpulseCount[0]), mode);
+		transferBytes((uint8_t *)(&collectedVSScycleCount[(uint16_t)(i)]), sizeof(collectedVSScycleCount[0]), mode);
+		transferBytes((uint8_t *)(&collectedInjPulseCount[(uint16_t)(i)]), sizeof(collectedInjPulseCount[0]), mode);
+		transferBytes((uint8_t *)(&collectedInjCycleCount[(uint16_t)(i)]), sizeof(collectedInjCycleCount[0]), mode);
+		transferBytes((uint8_t *)(&collectedEngCycleCount[(uint16_t)(i)]), sizeof(collectedEngCycleCount[0]), mode);
+
+	}
+
+	c = tjCRC;
+	crc.ui = c;
+
+	if (mode == tjmStore) transferBytes(crc.u8, sizeof(crc), tjmStore);
+	else transferBytes(crc.u8, sizeof(crc), tjmLoad);
+
+	return (crc.ui == c);
+
+}
+
+static void tripJournal::transferBytes(uint8_t * buff, uint8_t len, uint8_t mode)
+{
+
+	uint8_t b;
+
+	for (uint8_t x = 0; x < len; x++)
+	{
+
+		if (mode == tjmStore)
+		{
+
+			b = buff[(uint16_t)(x)];
+			if (EEPROM::readRawByte(tjAddress) != b) EEPROM::writeRawByte(tjAddress, b); // only program bytes that changed
+
+		}
+		else
+		{
+
+			b = EEPROM::readRawByte(tjAddress);
+			if (mode == tjmLoad) buff[(uint16_t)(x)] = b;
+
+		}
+
+		tjCRC = _crc_ccitt_update(tjCRC, b);
+		tjAddress++;
+
+	}
+
+}
+
+#endif // defined(useTripJournal)
+#if defined(useFuelLog)
+/* fuel-up history log support section */
+
+// find all valid fuel log records, and figure out where the next record goes
+static void fuelLog::init(void)
+{
+
+	uint16_t newestSequence = 0;
+
+	flValidRecords = 0;
+	flNewestRecordIdx = flRecordCount;
+
+	for (uint8_t x = 0; x < flRecordCount; x++)
+		if (transferRecord(x, flmVerify))
+		{
+
+			flValidRecords |= (1 << x);
+
+			// sequence numbers are compared modulo 65536, so that they may safely wrap around
+			if ((flNewestRecordIdx == flRecordCount) || ((int16_t)(flRecordSequence - newestSequence) > 0))
+			{
+
+				flNewestRecordIdx = x;
+				newestSequence = flRecordSequence;
+
+			}
+
+		}
+
+	if (flNewestRecordIdx < flRecordCount) flSequence = newestSequence + 1;
+	else flSequence = 0;
+
+	flViewIdx = flRecordCount;
+
+	scan();
+
+}
+
+// called just before the tank trip gets reset
+static void fuelLog::addTank(void)
+{
+
+#if !defined(useSeqlockTripAccess)
+	uint8_t oldSREG;
+#endif // !defined(useSeqlockTripAccess)
+	uint8_t i;
+
+	if (flRecordCount == 0) return;
+
+#if defined(useSeqlockTripAccess)
+	// only the main program ever writes to the tank trip, so it cannot change while it is being copied
+#else // defined(useSeqlockTripAccess)
+	oldSREG = SREG; // save interrupt flag status
+	cli(); // disable interrupts, so the tank trip cannot change while it is being copied
+
+#endif // defined(useSeqlockTripAccess)
+
+	for (uint8_t x = 0; x < flFieldCount; x++)
+	{
+
+		flFields[(uint16_t)(x)].ull = 0;
+
+		i = (uint8_t)(pgm_read_word(&fuelLogFields[(uint16_t)(x)]) >> 8);
+
+		switch (i)
+		{
+
+			case rvVSSpulseIdx:
+				flFields[(uint16_t)(x)].ul[0] = collectedVSSpulseCount[(uint16_t)(tankIdx)];
+				break;
+
+			case rvInjCycleIdx:
+				flFields[(uint16_t)(x)].ull = collectedInjCycleCount[(uint16_t)(tankIdx)];
+				break;
+
+			case rvEngCycleIdx:
+				flFields[(uint16_t)(x)].ull = collectedEngCycleCount[(uint16_t)(tankIdx)];
+				break;
+
+			default:
+				break;
+
+		}
+
+	}
+
+#if !defined(useSeqlockTripAccess)
+	SREG = oldSREG; // restore interrupt flag status
+
+#endif // !defined(useSeqlockTripAccess)
+	// an empty tank trip is not worth a record
+	if ((flFields[(uint16_t)(flDistanceFieldIdx)].ull == 0) && (flFields[(uint16_t)(flFuelFieldIdx)].ull == 0)) return;
+
+	if (flNewestRecordIdx < flRecordCount)
+	{
+
+		i = flNewestRecordIdx + 1;
+		if (i == flRecordCount) i = 0;
+
+	}
+	else i = 0;
+
+	transferRecord(i, flmStore);
+
+	flValidRecords |= (1 << i);
+	flNewestRecordIdx = i;
+	flSequence++;
+
+	scan();
+
+}
+
+// recalculates the log totals, and finds the records with the lowest and highest displayed fuel economy
+static void fuelLog::scan(void)
+{
+
+	uint8_t savedViewIdx;
+	uint32_t fe;
+	uint32_t minFE = 0;
+	uint32_t maxFE = 0;
+
+	for (uint8_t y = 0; y < flFieldCount; y++) flTotals[(uint16_t)(y)].ull = 0;
+
+	flMinFEidx = flRecordCount;
+	flMaxFEidx = flRecordCount;
+
+	savedViewIdx = flViewIdx;
+
+	for (uint8_t x = 0; x < flRecordCount; x++)
+		if (flValidRecords & (1 << x))
+		{
+
+			transferRecord(x, flmLoad);
+
+			for (uint8_t y = 0; y < flFieldCount; y++) flTotals[(uint16_t)(y)].ull += flFields[(uint16_t)(y)].ull;
+
+			// fuel economy is meaningless without both distance and fuel
+			if (flFields[(uint16_t)(flDistanceFieldIdx)].ull && flFields[(uint16_t)(flFuelFieldIdx)].ull)
+			{
+
+				flViewIdx = x;
+				fe = SWEET64::doCalculate(fuelLogRecordIdx, tFuelEcon);
+
+				if ((flMinFEidx == flRecordCount) || (fe < minFE))
+				{
+
+					flMinFEidx = x;
+					minFE = fe;
+
+				}
+
+				if ((flMaxFEidx == flRecordCount) || (fe > maxFE))
+				{
+
+					flMaxFEidx = x;
+					maxFE = fe;
+
+				}
+
+			}
+
+		}
+
+	flViewIdx = savedViewIdx;
+
+}
+
+// returns the record index of the tank logged (age) tanks before the newest one, or flRecordCount if there is no such valid record
+static uint8_t fuelLog::getRecordIdx(uint8_t age)
+{
+
+	uint8_t i;
+
+	if ((flNewestRecordIdx >= flRecordCount) || (age >= flRecordCount)) return flRecordCount;
+
+	i = flNewestRecordIdx + flRecordCount - age;
+	if (i >= flRecordCount) i -= flRecordCount;
+
+	if (flValidRecords & (1 << i)) return i;
+	else return flRecordCount;
+
+}
+
+static void fuelLog::load64(union union_64 * an, uint8_t tripIdx, uint8_t dataIdx)
+{
+
+	union union_64 * fields;
+	uint8_t i;
+
+	switch (tripIdx)
+	{
+
+		case fuelLogRecordIdx:
+			i = flViewIdx;
+			break;
+
+		case fuelLogMinFEidx:
+			i = flMinFEidx;
+			break;
+
+		case fuelLogMaxFEidx:
+			i = flMaxFEidx;
+			break;
+
+		default:
+			i = flRecordCount + 1; // use log totals
+			break;
+
+	}
+
+	if (i == flRecordCount) fields = 0;
+	else if (i > flRecordCount) fields = flTotals;
+	else if (transferRecord(i, flmLoad)) fields = flFields;
+	else fields = 0;
+
+	SWEET64::init64byt(an, 0);
+
+	if (fields)
+		for (uint8_t x = 0; x < flFieldCount; x++)
+			if ((uint8_t)(pgm_read_word(&fuelLogFields[(uint16_t)(x)]) >> 8) == dataIdx) SWEET64::copy64(an, &fields[(uint16_t)(x)]);
+
+}
+
+// returns 1 if the record CRC matches
+//
+// the CRC is seeded with the fuel log start address, so that records left over from a different EEPROM layout are not mistaken for valid ones
+static uint8_t fuelLog::transferRecord(uint8_t recordIdx, uint8_t mode)
+{
+
+	uint16_t c;
+	union union_16 crc;
+
+	flAddress = eeAdrFuelLogStart + (uint16_t)(recordIdx) * flRecordSize;
+	flCRC = eeAdrFuelLogStart;
+
+	if (mode == flmStore) transferBytes((uint8_t *)(&flSequence), sizeof(flSequence), flmStore);
+	else transferBytes((uint8_t *)(&flRecordSequence), sizeof(flRecordSequence), flmLoad);
+
+	for (uint8_t x = 0; x < flFieldCount; x++)
+	{
+
+		if (mode == flmLoad) flFields[(uint16_t)(x)].ull = 0;
+
+		// each field only takes up as many bytes as its bit length calls for
+		transferBytes(flFields[(uint16_t)(x)].u8, byteSize((uint8_t)(pgm_read_word(&fuelLogFields[(uint16_t)(x)]))), mode);
+
+	}
+
+	c = flCRC;
+	crc.ui = c;
+
+	if (mode == flmStore) transferBytes(crc.u8, sizeof(crc), flmStore);
+	else transferBytes(crc.u8, sizeof(crc), flmLoad);
+
+	return (crc.ui == c);
+
+}
+
+static void fuelLog::transferBytes(uint8_t * buff, uint8_t len, uint8_t mode)
+{
+
+	uint8_t b;
+
+	for (uint8_t x = 0; x < len; x++)
+	{
+
+		if (mode == flmStore)
+		{
+
+			b = buff[(uint16_t)(x)];
+			if (EEPROM::readRawByte(flAddress) != b) EEPROM::writeRawByte(flAddress, b); // only program bytes that changed
+
+		}
+		else
+		{
+
+			b = EEPROM::readRawByte(flAddress);
+			if (mode == flmLoad) buff[(uint16_t)(x)] = b;
+
+		}
+
+		flCRC = _crc_ccitt_update(flCRC, b);
+		flAddress++;
+
+	}
+
+}
+
+#if defined(useButtonInput)
+// page 0 shows log totals, page 1 shows the fuel economy range, and the remaining pages show logged tanks, newest first
+static uint8_t fuelLog::displayHandler(uint8_t cmd, uint8_t cursorPos)
+{
+
+	uint8_t i;
+
+	if (cursorPos < flSummaryPageCount) i = cursorPos;
+	else
+	{
+
+		flViewIdx = getRecordIdx(cursorPos - flSummaryPageCount);
+		i = (flViewIdx < flRecordCount) ? flSummaryPageCount : flSummaryPageCount + 1;
+
+	}
+
+	switch (cmd)
+	{
+
+		case displayInitialEntryIdx:
+			scan();
+
+		case displayCursorUpdateIdx:
+			text::statusOut(devLCD, fuelLogPageTitles, i); // briefly display page name
+
+		case displayOutputIdx:
+			if (i > flSummaryPageCount) i = flSummaryPageCount;
+			mainDisplay::outputPage(getFuelLogPageFormat, i, 136, 0);
+			break;
+
+		default:
+			break;
+
+	}
+
+}
+
+static uint16_t fuelLog::getFuelLogPageFormat(uint8_t formatIdx)
+{
+
+	return pgm_read_word(&fuelLogPageFormats[(uint16_t)(formatIdx)]);
+
+}
+
+#endif // defined(useButtonInput)
+#if defined(useDataLoggingOutput)
+// outputs one line per logged tank, oldest first and numbered by how many tanks ago it was logged, followed by lines for log totals and the lowest and highest fuel economy tanks
+static void fuelLog::outputDataLog(void)
+{
+
+	uint8_t savedViewIdx = flViewIdx;
+
+	text::stringOut(devLogOutput, PSTR("tank,distance,fuel,FE,engine time\n"));
+
+	for (uint8_t x = flRecordCount; x > 0; x--)
+	{
+
+		flViewIdx = getRecordIdx(x - 1);
+
+		if (flViewIdx < flRecordCount)
+		{
+
+			SWEET64::init64((union union_64 *)(&s64reg[s64reg2]), x);
+			text::stringOut(devLogOutput, ull2str(nBuff, 0, tFormatToNumber));
+			outputDataLogLine(fuelLogRecordIdx);
+
+		}
+
+	}
+
+	flViewIdx = savedViewIdx;
+
+	text::stringOut(devLogOutput, PSTR("total"));
+	outputDataLogLine(fuelLogTotalIdx);
+	text::stringOut(devLogOutput, PSTR("lowest FE"));
+	outputDataLogLine(fuelLogMinFEidx);
+	text::stringOut(devLogOutput, PSTR("highest FE"));
+	outputDataLogLine(fuelLogMaxFEidx);
+
+}
+
+static void fuelLog::outputDataLogLine(uint8_t tripIdx)
+{
+
+	uint8_t c = ',';
+
+	for (uint8_t x = 0; x < sizeof(fuelLogExportCalcs); x++)
+	{
+
+		text::charOut(devLogOutput, c);
+		text::tripFunctionOut(devLogOutput, tripIdx, pgm_read_byte(&fuelLogExportCalcs[(uint16_t)(x)]), 0, (dfOverflow9s));
+
+	}
+
+	text::charOut(devLogOutput, '\n');
+
+}
+
+#endif // defined(useDataLoggingOutput)
+#endif // defined(useFuelLog)
@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+"""Decode MPGuino binary telemetry (useBinaryLogging) into CSV or JSON lines.
+
+The MPGuino sends COBS-framed records, each terminated by a zero byte. Before
+framing, a record is:
+
+    record type (1 = schema, 2 = data), sequence number, body, CRC-16 (big-endian)
+
+The CRC is the AVR libc _crc_ccitt_update CRC, seeded with 0xFFFF, over the
+type, sequence, and body bytes.
+
+schema body - format version, field count, metric flag, samples per second,
+              samples per record (format version 2 onward), then
+              (trip index, function index, decimal places) per field
+data body   - one unsigned 32-bit little-endian value per field, scaled by 1000
+
+usage:
+    binlog_decode.py [--json] [input file, default stdin]
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+RECORD_SCHEMA = 0x01
+RECORD_DATA = 0x02
+FORMAT_VERSION = 2
+OVERFLOW = 0xFFFFFFFF
+
+
+def crc_ccitt_update(crc, data):
+    """Bit-for-bit copy of AVR libc _crc_ccitt_update."""
+    data ^= crc & 0xFF
+    data = (data ^ (data << 4)) & 0xFF
+    return ((data << 8) | (crc >> 8)) ^ (data >> 4) ^ ((data << 3) & 0xFFFF)
+
+
+def crc16(payload):
+    crc = 0xFFFF
+    for b in payload:
+        crc = crc_ccitt_update(crc, b)
+    return crc
+
+
+def cobs_decode(frame):
+    """Return the decoded bytes, or None if the frame is malformed."""
+    out = bytearray()
+    i = 0
+    while i < len(frame):
+        code = frame[i]
+        if code == 0 or i + code > len(frame):
+            return None
+        out += frame[i + 1:i + code]
+        i += code
+        if code < 0xFF and i < len(frame):
+            out.append(0)
+    return bytes(out)
+
+
+def split_frames(stream):
+    """Yield each zero-terminated frame from a binary stream."""
+    pending = bytearray()
+    while True:
+        chunk = stream.read(4096)
+        if not chunk:
+            break
+        pending += chunk
+        while True:
+            end = pending.find(0)
+            if end < 0:
+                break
+            frame = bytes(pending[:end])
+            del pending[:end + 1]
+            if frame:
+                yield frame
+
+
+class Decoder:
+    """Tracks the current schema, and turns records into rows."""
+
+    def __init__(self):
+        self.fields = None
+        self.metric = 0
+        self.rate = 0.0  # records per second
+        self.last_sequence = None
+        self.bad_frames = 0
+        self.lost_records = 0
+
+    def decode(self, frame):
+        """Return a ('schema' | 'data', payload) tuple, or None."""
+        record = cobs_decode(frame)
+        if record is None or len(record) < 4:
+            self.bad_frames += 1
+            return None
+        body, received = record[:-2], struct.unpack('>H', record[-2:])[0]
+        if crc16(body) != received:
+            self.bad_frames += 1
+            return None
+
+        record_type, sequence = body[0], body[1]
+        if self.last_sequence is not None:
+            self.lost_records += (sequence - self.last_sequence - 1) & 0xFF
+        self.last_sequence = sequence
+
+        body = body[2:]
+        if record_type == RECORD_SCHEMA:
+            return self._schema(body)
+        if record_type == RECORD_DATA:
+            return self._data(sequence, body)
+        self.bad_frames += 1
+        return None
+
+    def _schema(self, body):
+        if len(body) < 4:
+            self.bad_frames += 1
+            return None
+        version, count, metric, samples_per_second = body[:4]
+        if version == 1:  # version 1 sent a record every sample
+            start, samples_per_record = 4, 1
+        elif version == FORMAT_VERSION and len(body) >= 5:
+            start, samples_per_record = 5, body[4]
+        else:
+            self.bad_frames += 1
+            return None
+        if len(body) != start + 3 * count or samples_per_record == 0:
+            self.bad_frames += 1
+            return None
+        fields = [tuple(body[start + 3 * x:start + 3 + 3 * x]) for x in range(count)]
+        changed = fields != self.fields
+        self.fields, self.metric = fields, metric
+        self.rate = samples_per_second / float(samples_per_record)
+        return ('schema', changed)
+
+    def _data(self, sequence, body):
+        if self.fields is None or len(body) != 4 * len(self.fields):
+            return None  # no schema seen yet, or schema does not match
+        values = struct.unpack('<%dI' % len(self.fields), body)
+        row = {'seq': sequence}
+        for (trip, calc, places), value in zip(self.fields, values):
+            row[column_name(trip, calc)] = (None if value == OVERFLOW
+                                            else round(value / 1000.0, places))
+        return ('data', row)
+
+
+def column_name(trip, calc):
+    return 't%uf%u' % (trip, calc)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--json', action='store_true', help='output JSON lines instead of CSV')
+    parser.add_argument('input', nargs='?', help='captured binary stream (default stdin)')
+    args = parser.parse_args()
+
+    stream = open(args.input, 'rb') if args.input else sys.stdin.buffer
+    decoder = Decoder()
+
+    for frame in split_frames(stream):
+        result = decoder.decode(frame)
+        if result is None:
+            continue
+        kind, payload = result
+        if kind == 'schema':
+            if payload and not args.json:
+                names = [column_name(t, c) for t, c, _ in decoder.fields]
+                print(','.join(['seq'] + names))
+        elif args.json:
+            print(json.dumps(payload))
+        else:
+            print(','.join('' if v is None else str(v) for v in payload.values()))
+
+    sys.stderr.write('bad frames: %u, lost records: %u\n' % (decoder.bad_frames, decoder.lost_records))
+
+
+if __name__ == '__main__':
+    main()
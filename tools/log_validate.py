@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+"""Check an MPGuino data logging or JSON capture (useLogRecordStamps) for lost records and timing jitter.
+
+With useLogRecordStamps, every data logging line starts with a sequence number and a millisecond timestamp:
+
+    sequence,milliseconds,field,field,...
+
+and the first graph object of every JSON payload starts with "seq" and "ms" keys:
+
+    [{"seq":sequence,"ms":milliseconds,"title":...},{...},{...}]
+
+Sequence numbers wrap from 65535 to 0, and timestamps wrap from 2^32 - 1 to 0. Either kind of capture, or a mix of
+both, can be checked. Data logging lines and JSON payloads are numbered independently, so each kind is tracked and
+reported on its own. Lines that are neither are counted as malformed, except blank lines, which separate JSON payloads.
+
+usage:
+    log_validate.py [--period MS] [input file, default stdin]
+"""
+
+import argparse
+import json
+import math
+import sys
+
+SEQUENCE_MODULUS = 1 << 16
+TIME_MODULUS = 1 << 32
+
+
+KINDS = (('log', 'data logging'), ('json', 'JSON'))
+
+
+def parse_record(line):
+    """Return (kind, sequence, milliseconds) for one line, or None if the line carries no stamp."""
+    if line.startswith('['):
+        try:
+            payload = json.loads(line)
+            first = payload[0]
+            return 'json', int(first['seq']), int(first['ms'])
+        except (ValueError, KeyError, IndexError, TypeError):
+            return None
+    fields = line.split(',')
+    if len(fields) < 2:
+        return None
+    try:
+        return 'log', int(fields[0]), int(fields[1])
+    except ValueError:
+        return None
+
+
+class Validator:
+    """Accumulates sequence gaps and record intervals for one kind of record."""
+
+    def __init__(self):
+        self.received = 0
+        self.lost = 0
+        self.duplicates = 0
+        self.restarts = 0
+        self.intervals = []
+        self.last = None
+
+    def add(self, sequence, milliseconds):
+        self.received += 1
+        if self.last is not None:
+            last_sequence, last_milliseconds = self.last
+            gap = (sequence - last_sequence) % SEQUENCE_MODULUS
+            elapsed = (milliseconds - last_milliseconds) % TIME_MODULUS
+            if gap == 0:
+                self.duplicates += 1
+                return
+            if gap > SEQUENCE_MODULUS // 2 or elapsed > TIME_MODULUS // 2:
+                self.restarts += 1  # sequence went backwards - MPGuino was most likely reset
+            else:
+                self.lost += gap - 1
+                self.intervals.append(elapsed / gap)  # spread the elapsed time over any lost records
+        self.last = (sequence, milliseconds)
+
+    def report(self, out, period):
+        expected = self.received + self.lost
+        out.write('records received: %u\n' % self.received)
+        out.write('records lost: %u (%.3f%%)\n' % (self.lost, 100.0 * self.lost / expected if expected else 0.0))
+        out.write('duplicate records: %u\n' % self.duplicates)
+        out.write('sequence restarts: %u\n' % self.restarts)
+        if not self.intervals:
+            return
+        intervals = sorted(self.intervals)
+        count = len(intervals)
+        mean = sum(intervals) / count
+        if period is None:
+            period = intervals[count // 2]  # assume the median interval is the intended one
+        deviations = [abs(x - period) for x in intervals]
+        out.write('record interval (ms): min %.1f, mean %.1f, max %.1f, expected %.1f\n'
+                  % (intervals[0], mean, intervals[-1], period))
+        out.write('jitter (ms): rms %.2f, p99 %.2f, max %.2f\n'
+                  % (math.sqrt(sum(x * x for x in deviations) / count),
+                     sorted(deviations)[min(count - 1, int(count * 0.99))],
+                     max(deviations)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--period', type=float, help='expected record interval in ms (default: median interval)')
+    parser.add_argument('input', nargs='?', help='captured output (default stdin)')
+    args = parser.parse_args()
+
+    stream = open(args.input, 'r', errors='replace') if args.input else sys.stdin
+    validators = dict((kind, Validator()) for kind, _ in KINDS)
+    malformed = 0
+
+    for line in stream:
+        line = line.strip()
+        if not line:
+            continue
+        record = parse_record(line)
+        if record is None:
+            malformed += 1
+        else:
+            validators[record[0]].add(*record[1:])
+
+    reported = [(name, validators[kind]) for kind, name in KINDS if validators[kind].received]
+    for name, validator in reported:
+        if len(reported) > 1:
+            sys.stdout.write('%s records:\n' % name)
+        validator.report(sys.stdout, args.period)
+    if not reported:
+        validators['log'].report(sys.stdout, args.period)
+    sys.stdout.write('malformed lines: %u\n' % malformed)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,347 @@
+#!/usr/bin/env python3
+"""Convert MPGuino data logging, JSON, and binary telemetry captures into per-field column files with summaries.
+
+Each input (a capture file, a serial port or pseudo-tty, or - for stdin) gets its own output directory, named after the
+input's path as given (so car1/log.txt and car2/log.txt do not collide), holding
+
+    <field>.f64     one little-endian IEEE double per record, NaN where the record did not carry that field
+    columns.json    source, detected format, record count, bad record count, records per second (binary only, from
+                    the last schema record), and per-field count/min/max/mean
+
+Formats are detected per input:
+
+    binary   COBS-framed useBinaryLogging records - anything containing a zero byte
+    text     data logging CSV lines and JSON payload lines, which may be mixed
+
+CSV lines carry no field names, so columns are named c0, c1, ... unless --columns is given. --stamped names the first two
+columns seq and ms, for captures made with useLogRecordStamps. JSON payloads are flattened into g<graph>.<key>[index]
+columns, and binary records use the t<trip>f<function> names from their schema records.
+
+Regular files are memory-mapped and split into lines or frames with mmap.find, rather than read through Python file
+objects. This is not zero-copy: each line or frame is sliced out as its own bytes object, which the parsers need anyway.
+Many inputs (for instance, one capture per vehicle) are processed in parallel by a pool of worker processes.
+
+usage:
+    mpguino_ingest.py [-o OUTPUT] [-j JOBS] [--columns NAMES] [--stamped] input [input ...]
+"""
+
+import argparse
+import json
+import math
+import mmap
+import os
+import re
+import stat
+import sys
+from array import array
+from concurrent.futures import ProcessPoolExecutor
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import binlog_decode  # noqa: E402  (shares the COBS/CRC/schema decoder)
+
+NAN = float('nan')
+FLUSH_ROWS = 1 << 16  # rows buffered per column before they are appended to disk
+DETECT_BYTES = 4096
+
+
+class Column:
+    """One output field - buffers values, appends them to its file, and keeps running statistics."""
+
+    def __init__(self, directory, name, rows_before):
+        self.name = name
+        self.file_name = re.sub(r'[^A-Za-z0-9_.-]', '_', name) + '.f64'
+        self.handle = open(os.path.join(directory, self.file_name), 'wb')
+        self.values = array('d')
+        self.count = 0
+        self.minimum = math.inf
+        self.maximum = -math.inf
+        self.total = 0.0
+        self.pad(rows_before)  # a column that first shows up mid-capture is missing from all earlier records
+
+    def pad(self, rows):
+        while rows > 0:
+            step = min(rows, FLUSH_ROWS)
+            self.values.extend(array('d', [NAN]) * step)
+            rows -= step
+            self.flush()
+
+    def flush(self):
+        if not self.values:
+            return
+        present = [v for v in self.values if v == v]
+        if present:
+            self.count += len(present)
+            self.minimum = min(self.minimum, min(present))
+            self.maximum = max(self.maximum, max(present))
+            self.total += math.fsum(present)
+        if sys.byteorder != 'little':
+            self.values.byteswap()
+        self.values.tofile(self.handle)
+        self.values = array('d')
+
+    def close(self):
+        self.flush()
+        self.handle.close()
+
+    def summary(self):
+        result = {'name': self.name, 'file': self.file_name, 'count': self.count}
+        if self.count:
+            result.update(min=self.minimum, max=self.maximum, mean=self.total / self.count)
+        return result
+
+
+class ColumnSet:
+    """Routes each record's values to its columns, padding absent fields with NaN."""
+
+    def __init__(self, directory):
+        self.directory = directory
+        self.columns = {}
+        self.order = []
+        self.rows = 0
+        self.bad = 0
+        self.rate = None
+        self.layouts = {}
+
+    def _layout(self, names):
+        # cache which Column objects a given tuple of field names maps to, and which columns it leaves out
+        layout = self.layouts.get(names)
+        if layout is None:
+            for name in names:
+                if name not in self.columns:
+                    self.columns[name] = Column(self.directory, name, self.rows)
+                    self.order.append(name)
+                    self.layouts.clear()
+            present = set(names)
+            targets = [self.columns[name] for name in names]
+            absent = [self.columns[name] for name in self.order if name not in present]
+            layout = self.layouts[names] = (targets, absent)
+        return layout
+
+    def add(self, names, values):
+        targets, absent = self._layout(names)
+        for column, value in zip(targets, values):
+            column.values.append(value)
+        for column in absent:
+            column.values.append(NAN)
+        self.rows += 1
+        if self.rows % FLUSH_ROWS == 0:
+            for column in self.columns.values():
+                column.flush()
+
+    def close(self, source, detected):
+        for column in self.columns.values():
+            column.close()
+        with open(os.path.join(self.directory, 'columns.json'), 'w') as handle:
+            summary = {'source': source, 'format': detected, 'records': self.rows, 'bad_records': self.bad}
+            if self.rate is not None:
+                summary['records_per_second'] = self.rate
+            summary['columns'] = [self.columns[name].summary() for name in self.order]
+            json.dump(summary, handle, indent=1)
+
+
+def number(field):
+    return float(field) if field else NAN  # an empty CSV field is a value the change-driven logger left out
+
+
+def flatten_json(payload):
+    names = []
+    values = []
+    for graph_idx, graph in enumerate(payload):
+        for key, value in graph.items():
+            if isinstance(value, list):
+                for idx, item in enumerate(value):
+                    if isinstance(item, (int, float)):
+                        names.append('g%u.%s%u' % (graph_idx, key, idx))
+                        values.append(float(item))
+            elif isinstance(value, (int, float)):
+                names.append('g%u.%s' % (graph_idx, key))
+                values.append(float(value))
+    return tuple(names), values
+
+
+class TextParser:
+    """Turns CSV and JSON payload lines into records."""
+
+    def __init__(self, columns, csv_names):
+        self.columns = columns
+        self.csv_names = csv_names
+        self.width_names = {}
+
+    def _names(self, width):
+        names = self.width_names.get(width)
+        if names is None:
+            names = tuple(self.csv_names[x] if x < len(self.csv_names) else 'c%u' % x for x in range(width))
+            self.width_names[width] = names
+        return names
+
+    def line(self, line):
+        line = line.strip()
+        if not line:
+            return
+        try:
+            if line[:1] == b'[':
+                names, values = flatten_json(json.loads(line))
+            else:
+                fields = line.split(b',')
+                values = [number(field) for field in fields]
+                names = self._names(len(values))
+        except (ValueError, AttributeError, TypeError):
+            self.columns.bad += 1
+            return
+        self.columns.add(names, values)
+
+
+class BinaryParser:
+    """Turns COBS-framed binary telemetry frames into records."""
+
+    def __init__(self, columns):
+        self.columns = columns
+        self.decoder = binlog_decode.Decoder()
+
+    def frame(self, frame):
+        result = self.decoder.decode(frame)
+        if result is None:
+            return
+        kind, row = result
+        if kind == 'data':
+            names = tuple(row)
+            self.columns.add(names, [NAN if v is None else float(v) for v in row.values()])
+
+    def close(self):
+        self.columns.bad += self.decoder.bad_frames
+        if self.decoder.fields is not None:
+            self.columns.rate = self.decoder.rate
+
+
+def mapped_pieces(mapped, separator):
+    # mmap.find and slicing run in C, so the only per-record Python work is the parsing itself - each slice is a copy of
+    #    one line or frame, which is fine, as the parsers need bytes objects anyway
+    start = 0
+    end = len(mapped)
+    while start < end:
+        stop = mapped.find(separator, start)
+        if stop < 0:
+            yield mapped[start:end]
+            return
+        yield mapped[start:stop]
+        start = stop + 1
+
+
+def streamed_pieces(handle, separator):
+    pending = b''
+    while True:
+        chunk = os.read(handle.fileno(), 1 << 16)
+        if not chunk:
+            break
+        pieces = (pending + chunk).split(separator)
+        pending = pieces.pop()
+        yield from pieces
+    if pending:
+        yield pending
+
+
+def detect(head):
+    return 'binary' if b'\x00' in head else 'text'
+
+
+def output_name(source):
+    """Name an input's output directory after its whole path, not just its file name."""
+    if source == '-':
+        return 'stdin'
+    path = os.path.splitdrive(os.path.normpath(source))[1].strip(os.sep) or source
+    return re.sub(r'[^A-Za-z0-9_.-]', '_', path)
+
+
+def ingest(source, directory, csv_names):
+    """Process one input into its own output directory, and return a one-line report."""
+    os.makedirs(directory, exist_ok=True)
+    columns = ColumnSet(directory)
+
+    handle = sys.stdin.buffer if source == '-' else open(source, 'rb')
+    mapped = None
+    detected = 'empty'
+    try:
+        if source != '-' and stat.S_ISREG(os.fstat(handle.fileno()).st_mode) and os.fstat(handle.fileno()).st_size:
+            mapped = mmap.mmap(handle.fileno(), 0, access=mmap.ACCESS_READ)
+            detected = detect(mapped[:DETECT_BYTES])
+            pieces = mapped_pieces(mapped, b'\x00' if detected == 'binary' else b'\n')
+        else:
+            # a serial port, pseudo-tty, or pipe cannot be mapped, so peek at its first chunk to pick the format
+            head = os.read(handle.fileno(), DETECT_BYTES)
+            detected = detect(head)
+            separator = b'\x00' if detected == 'binary' else b'\n'
+            rest = streamed_pieces(handle, separator)
+            pieces = chain_head(head, rest, separator)
+
+        if detected == 'binary':
+            parser = BinaryParser(columns)
+            for piece in pieces:
+                if piece:
+                    parser.frame(bytes(piece))
+            parser.close()
+        else:
+            parser = TextParser(columns, csv_names)
+            for piece in pieces:
+                parser.line(piece)
+    finally:
+        if mapped is not None:
+            mapped.close()
+        if handle is not sys.stdin.buffer:
+            handle.close()
+        columns.close(source, detected)
+
+    return '%s: %s, %u records, %u bad, %u fields -> %s' % (source, detected, columns.rows, columns.bad,
+                                                             len(columns.order), directory)
+
+
+def chain_head(head, rest, separator):
+    """Join the peeked first chunk back onto the rest of a streamed input."""
+    pieces = head.split(separator)
+    pending = pieces.pop()
+    yield from pieces
+    first = True
+    for piece in rest:
+        if first:
+            piece = pending + piece
+            first = False
+        yield piece
+    if first and pending:
+        yield pending
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('inputs', nargs='+', help='capture files, serial devices, or - for stdin')
+    parser.add_argument('-o', '--output', default='ingested', help='output directory (default: ingested)')
+    parser.add_argument('-j', '--jobs', type=int, default=os.cpu_count(), help='worker processes (default: CPU count)')
+    parser.add_argument('--columns', default='', help='comma-separated CSV field names')
+    parser.add_argument('--stamped', action='store_true', help='CSV lines start with sequence and millisecond fields')
+    args = parser.parse_args()
+
+    csv_names = [name for name in args.columns.split(',') if name]
+    if args.stamped:
+        csv_names = ['seq', 'ms'] + csv_names
+
+    directories = [os.path.join(args.output, output_name(source)) for source in args.inputs]
+    claimed = {}
+    for source, directory in zip(args.inputs, directories):
+        if directory in claimed:
+            parser.error('%s and %s would both be written to %s' % (claimed[directory], source, directory))
+        claimed[directory] = source
+
+    os.makedirs(args.output, exist_ok=True)
+
+    if len(args.inputs) == 1 or args.jobs <= 1 or '-' in args.inputs:
+        for source, directory in zip(args.inputs, directories):
+            print(ingest(source, directory, csv_names))
+        return
+
+    # parsing is CPU bound, so a pool of processes rather than threads is what actually runs captures side by side
+    with ProcessPoolExecutor(max_workers=args.jobs) as pool:
+        jobs = [pool.submit(ingest, source, directory, csv_names) for source, directory in zip(args.inputs, directories)]
+        for job in jobs:
+            print(job.result())
+
+
+if __name__ == '__main__':
+    main()